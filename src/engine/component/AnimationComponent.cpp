@@ -1,6 +1,8 @@
 #include "AnimationComponent.hpp"
 #include "../object/GameObject.hpp"
 #include "../render/Animation.hpp"
+#include "../scene/CommandBuffer.hpp"
+#include "../scene/Scene.hpp"
 #include "SpriteComponent.hpp"
 
 #include <spdlog/spdlog.h>
@@ -33,8 +35,22 @@ void AnimationComponent::update(float deltaTime, engine::core::Context &) {
     if (!m_currentAnimation->isLooping() && m_animationTimer >= m_currentAnimation->getTotalDuration()) {
         m_isPlaying = false;
         m_animationTimer = m_currentAnimation->getTotalDuration(); // 将时间限制在结束点
-        if (m_isOneShotRemoval)
-            m_owner->setNeedRemove(true); // 如果 m_isOneShotRemoval 为 true，则删除整个 GameObject
+        if (m_isOneShotRemoval) {
+            // 如果 m_isOneShotRemoval 为 true，则删除整个 GameObject (并行阶段中只记录命令，在同步点执行)
+            if (auto *scene = m_owner->getScene()) {
+                scene->getCommandBuffer().destroy(m_owner->getHandle());
+            } else {
+                m_owner->setNeedRemove(true);
+            }
+        }
+    }
+}
+
+void AnimationComponent::reset() {
+    m_animationTimer = 0.0f;
+    m_isPlaying = m_currentAnimation != nullptr;
+    if (m_spriteComponent && m_currentAnimation && !m_currentAnimation->isEmpty()) {
+        m_spriteComponent->setSourceRect(m_currentAnimation->getFrame(0.0f).sourceRect);
     }
 }
 
@@ -24,6 +24,9 @@ namespace engine::component {
 class AnimationComponent : public Component {
     friend class engine::object::GameObject;
 
+  public:
+    static constexpr ComponentType TYPE = ComponentType::Animation; ///< @brief 编译期组件ID
+
   private:
     std::unordered_map<std::string, std::unique_ptr<engine::render::Animation>> m_animations; /// @brief 动画名称到 Animation 对象的映射
     SpriteComponent *m_spriteComponent = nullptr;                                             ///< @brief 指向必需的SpriteComponent的指针
@@ -52,11 +55,14 @@ class AnimationComponent : public Component {
     bool isAnimationFinished() const;
     bool isOneShotRemoval() const { return m_isOneShotRemoval; }
     void setOneShotRemoval(bool isOneShotRemoval) { m_isOneShotRemoval = isOneShotRemoval; }
+    bool isThreadSafeUpdate() const override { return true; } ///< @brief 只推进自身计时器并修改自身的精灵，可以并行更新
+    bool needsUpdate() const override { return true; }        ///< @brief 每帧推进动画
 
   protected:
     // 核心循环方法
     void init() override;
     void update(float, engine::core::Context &) override;
+    void reset() override; ///< @brief 从头重新播放当前动画
 };
 
 } // namespace engine::component
\ No newline at end of file
@@ -1,5 +1,9 @@
 #pragma once
 #include "../core/Context.hpp"
+#include "../utils/PoolAllocator.hpp"
+
+#include <cstddef>
+#include <cstdint>
 
 namespace engine::object {
 class GameObject;
@@ -11,6 +15,25 @@ class Context;
 
 namespace engine::component {
 
+/**
+ * @enum ComponentType
+ * @brief 编译期组件ID，同时决定组件在 GameObject 中的存储位置和 update / render / handleInput 的执行顺序
+ *
+ * 每个组件类用 `static constexpr ComponentType TYPE` 声明自己的ID。新增组件时在此处按执行顺序插入，
+ * 例如 Animation 必须在 Sprite 之前，保证同一帧内精灵渲染的是动画更新后的帧。
+ */
+enum class ComponentType : std::uint8_t {
+    Transform, ///< @brief TransformComponent (最先，其他组件依赖其位置)
+    Animation, ///< @brief AnimationComponent (在 Sprite 之前更新源矩形)
+    Health,    ///< @brief HealthComponent
+    Sprite,    ///< @brief SpriteComponent
+    Parallax,  ///< @brief ParallaxComponent
+    TileLayer, ///< @brief TileLayerComponent
+    Count      ///< @brief 组件类型数量，不是有效类型
+};
+
+inline constexpr size_t COMPONENT_TYPE_COUNT = static_cast<size_t>(ComponentType::Count);
+
 /**
  * @brief 组件基类，所有游戏组件的父类
  *
@@ -34,14 +57,46 @@ class Component {
     Component(Component &&) = delete;
     Component &operator=(Component &&) = delete;
 
+    /// @brief 组件可能来自场景的对象内存池 (ObjectArena)，也可能直接 new，统一由 PoolAllocator 根据块头释放
+    static void *operator new(std::size_t size) { return engine::utils::PoolAllocator::allocateUnpooled(size); }
+    static void operator delete(void *ptr) { engine::utils::PoolAllocator::deallocate(ptr); }
+
     void setOwner(engine::object::GameObject *owner);
     engine::object::GameObject *getOwner() const;
 
+    /**
+     * @brief 该组件的 update 是否可以与其他对象并行执行
+     *
+     * 返回 true 的组件在 update 中只能读写自己所属 GameObject 的状态 (如计时器)，
+     * 不能访问其他对象、直接增删对象或组件、触发事件。生成 / 销毁对象、增删组件等结构性修改
+     * 通过 Scene::getCommandBuffer() 记录，在更新末尾的同步点统一执行。
+     */
+    virtual bool isThreadSafeUpdate() const { return false; }
+    /**
+     * @brief 该组件的 update 是否有实际工作
+     *
+     * 场景只遍历至少有一个组件返回 true 的对象。默认返回 true，忘记重写也不会悄悄停止更新；
+     * update 为空的组件 (变换、精灵、瓦片层等) 重写为 false，只由这些组件构成的静态对象每帧不会被访问。
+     */
+    virtual bool needsUpdate() const { return true; }
+    /**
+     * @brief 该组件的 handleInput 是否有实际工作
+     *
+     * 目前没有组件处理输入，默认返回 false；重写 handleInput 的组件必须同时重写本函数返回 true。
+     */
+    virtual bool needsInput() const { return false; }
+
   protected:
     virtual void init() {}
     virtual void handleInput(engine::core::Context &) {}
     virtual void update(float, engine::core::Context &) {}
     virtual void render(engine::core::Context &) {}
     virtual void clean() {}
+    /**
+     * @brief 对象被回收到场景的对象池时调用 (见 Scene::acquireGameObject)
+     *
+     * 恢复运行时状态 (计时器、生命值等)，保留配置 (纹理、动画、最大生命值等)，使对象可以作为同一种对象再次使用。
+     */
+    virtual void reset() {}
 };
 } // namespace engine::component
@@ -22,6 +22,12 @@ void HealthComponent::update(float deltaTime, engine::core::Context &) {
     }
 }
 
+void HealthComponent::reset() {
+    m_currentHealth = m_maxHealth;
+    m_isInvincible = false;
+    m_invincibilityTimer = 0.0f;
+}
+
 bool HealthComponent::takeDamage(int damageAmount) {
     if (damageAmount <= 0 || !isAlive()) {
         return false; // 不造成伤害或已经死亡
@@ -6,6 +6,9 @@ namespace engine::component {
 class HealthComponent final : public engine::component::Component {
     friend class engine::object::GameObject;
 
+  public:
+    static constexpr ComponentType TYPE = ComponentType::Health; ///< @brief 编译期组件ID
+
   private:
     int m_maxHealth = 1;                  ///< @brief 最大生命值
     int m_currentHealth = 1;              ///< @brief 当前生命值
@@ -46,9 +49,12 @@ class HealthComponent final : public engine::component::Component {
     void setMaxHealth(int maxHealth);                                                     ///< @brief 设置最大生命值 (确保不小于 1)。
     void setInvincible(float duration);                                                   ///< @brief 设置 GameObject 进入无敌状态，持续时间为 duration 秒。
     void setInvincibilityDuration(float duration) { m_invincibilityDuration = duration; } ///< @brief 设置无敌状态持续时间
+    bool isThreadSafeUpdate() const override { return true; }                             ///< @brief 只更新无敌计时器，可以并行更新
+    bool needsUpdate() const override { return true; }                                    ///< @brief 每帧更新无敌计时器
 
   protected:
     void update(float, engine::core::Context &) override;
+    void reset() override; ///< @brief 恢复满生命值并取消无敌
 };
 
 } // namespace engine::component
\ No newline at end of file
@@ -11,6 +11,9 @@ class TransformComponent;
 class ParallaxComponent final : public Component {
     friend class engine::object::GameObject;
 
+  public:
+    static constexpr ComponentType TYPE = ComponentType::Parallax; ///< @brief 编译期组件ID
+
   private:
     TransformComponent *m_transform = nullptr; ///< @brief 缓存变换组件
 
@@ -36,6 +39,7 @@ class ParallaxComponent final : public Component {
     const glm::vec2 &getScrollFactor() const { return m_scrollFactor; }  ///< @brief 获取滚动速度因子
     const glm::bvec2 &getRepeat() const { return m_repeat; }             ///< @brief 获取是否重复
     bool isHidden() const { return m_isHidden; }                         ///< @brief 获取是否隐藏（不渲染）
+    bool needsUpdate() const override { return false; } ///< @brief update 为空，只在渲染阶段工作
 
   protected:
     void update(float, engine::core::Context &) override {} // 必须实现纯虚函数，留空
@@ -40,40 +40,9 @@ void SpriteComponent::updateOffset() {
         m_offset = {0.0f, 0.0f};
         return;
     }
-    auto scale = m_transform->getScale();
-    // 计算精灵左上角相对于 TransformComponent::position_ 的偏移
-    switch (m_alignment) {
-    case engine::utils::Alignment::TOP_LEFT:
-        m_offset = glm::vec2{0.0f, 0.0f} * scale;
-        break;
-    case engine::utils::Alignment::TOP_CENTER:
-        m_offset = glm::vec2{-m_spriteSize.x / 2.0f, 0.0f} * scale;
-        break;
-    case engine::utils::Alignment::TOP_RIGHT:
-        m_offset = glm::vec2{-m_spriteSize.x, 0.0f} * scale;
-        break;
-    case engine::utils::Alignment::CENTER_LEFT:
-        m_offset = glm::vec2{0.0f, -m_spriteSize.y / 2.0f} * scale;
-        break;
-    case engine::utils::Alignment::CENTER:
-        m_offset = glm::vec2{-m_spriteSize.x / 2.0f, -m_spriteSize.y / 2.0f} * scale;
-        break;
-    case engine::utils::Alignment::CENTER_RIGHT:
-        m_offset = glm::vec2{-m_spriteSize.x, -m_spriteSize.y / 2.0f} * scale;
-        break;
-    case engine::utils::Alignment::BOTTOM_LEFT:
-        m_offset = glm::vec2{0.0f, -m_spriteSize.y} * scale;
-        break;
-    case engine::utils::Alignment::BOTTOM_CENTER:
-        m_offset = glm::vec2{-m_spriteSize.x / 2.0f, -m_spriteSize.y} * scale;
-        break;
-    case engine::utils::Alignment::BOTTOM_RIGHT:
-        m_offset = glm::vec2{-m_spriteSize.x, -m_spriteSize.y} * scale;
-        break;
-    case engine::utils::Alignment::NONE:
-    default:
-        break;
-    }
+    // 计算精灵左上角相对于 TransformComponent::position_ 的偏移 (NONE 时保持手动设置的偏移)
+    if (m_alignment == engine::utils::Alignment::NONE) return;
+    m_offset = engine::utils::getAlignmentOffset(m_alignment, m_spriteSize * m_transform->getScale());
 }
 
 /// @name getter
@@ -139,11 +108,12 @@ void SpriteComponent::render(engine::core::Context &context) {
     }
 
     // 获取变换信息（考虑偏移量）
-    const glm::vec2 &pos = m_transform->getPosition() + m_offset;
+    // 固定步长模式下使用插值位置，使渲染在两次模拟之间平滑过渡
+    const glm::vec2 &pos = m_transform->getInterpolatedPosition(context.getRenderer().getInterpolationAlpha()) + m_offset;
     const glm::vec2 &scale = m_transform->getScale();
     float rotationDegrees = m_transform->getRotation();
 
     // 执行绘制
-    context.getRenderer().drawSprite(context.getCamera(), m_sprite, pos, scale, rotationDegrees);
+    context.getRenderer().drawSprite(context.getCamera(), m_sprite, pos, scale, rotationDegrees, m_layer);
 }
 } // namespace engine::component
\ No newline at end of file
@@ -1,4 +1,5 @@
 #pragma once
+#include "../render/RenderCommand.hpp"
 #include "../render/Sprite.hpp"
 #include "../utils/Alignment.hpp"
 #include "Component.hpp"
@@ -34,15 +35,20 @@ class TransformComponent;
  */
 class SpriteComponent final : public Component {
     friend class engine::object::GameObject; ///< 声明为友元类，允许GameObject访问私有成员
+
+  public:
+    static constexpr ComponentType TYPE = ComponentType::Sprite; ///< @brief 编译期组件ID
+
   private:
     resource::ResourceManager *m_resourceManager = nullptr; ///< @brief 保存资源管理器指针，用于获取纹理大小
     TransformComponent *m_transform = nullptr;              ///< @brief 缓存 TransformComponent 指针（非必须）
 
-    utils::Alignment m_alignment = utils::Alignment::NONE; ///< @brief 对齐方式
-    render::Sprite m_sprite;                               ///< @brief 精灵对象
-    glm::vec2 m_spriteSize = {0.0f, 0.0f};                 ///< @brief 精灵尺寸
-    glm::vec2 m_offset = {0.0f, 0.0f};                     ///< @brief 偏移量
-    bool m_isHidden = false;                               ///< @brief 是否隐藏（不渲染）
+    utils::Alignment m_alignment = utils::Alignment::NONE;    ///< @brief 对齐方式
+    render::Sprite m_sprite;                                  ///< @brief 精灵对象
+    glm::vec2 m_spriteSize = {0.0f, 0.0f};                    ///< @brief 精灵尺寸
+    glm::vec2 m_offset = {0.0f, 0.0f};                        ///< @brief 偏移量
+    bool m_isHidden = false;                                  ///< @brief 是否隐藏（不渲染）
+    render::RenderLayer m_layer = render::RenderLayer::Units; ///< @brief 渲染图层 (默认按底边 Y 排序的单位层)
 
   public:
 #pragma region 构造函数/析构函数
@@ -87,6 +93,7 @@ class SpriteComponent final : public Component {
     std::string_view getTextureID() const { return m_sprite.getTextureID(); }
     bool isFlipped() const { return m_sprite.isFlipped(); }
     bool isHidden() const { return m_isHidden; }
+    render::RenderLayer getLayer() const { return m_layer; }
 
     /**
      * @brief 通过纹理ID设置精灵
@@ -98,6 +105,8 @@ class SpriteComponent final : public Component {
     void setHidden(bool hidden);
     void setSourceRect(std::optional<SDL_FRect> sourceRectOpt);
     void setAlignment(engine::utils::Alignment anchor);
+    void setLayer(render::RenderLayer layer) { m_layer = layer; }
+    bool needsUpdate() const override { return false; } ///< @brief update 为空，只在渲染阶段工作
 
   private:
     void updateSpriteSize();
@@ -1,12 +1,64 @@
 #include "TilelayerComponent.hpp"
 #include "../core/Context.hpp"
+#include "../debug/Trace.hpp"
 #include "../object/GameObject.hpp"
 #include "../render/Camera.hpp"
 #include "../render/Renderer.hpp"
 
+#include <glm/common.hpp>
 #include <spdlog/spdlog.h>
 
+#include <cmath>
+#include <utility>
+
 namespace engine::component {
+glm::vec2 getTileOverhang(const TileInfo &tileInfo, glm::ivec2 tileSize) {
+    const auto &sourceRect = tileInfo.sprite.getSourceRect();
+    if (tileInfo.type == TileType::EMPTY || !sourceRect.has_value()) return {0.0f, 0.0f};
+    return glm::max(glm::vec2(sourceRect->w, sourceRect->h) - glm::vec2(tileSize), glm::vec2(0.0f));
+}
+
+std::pair<glm::ivec2, glm::ivec2> getVisibleTileRange(const render::Camera &camera, glm::vec2 offset, glm::ivec2 tileSize,
+                                                      glm::ivec2 mapSize, glm::vec2 maxOverhang) {
+    if (tileSize.x <= 0 || tileSize.y <= 0) return {{0, 0}, {0, 0}};
+    // 视口在图层中的范围；下方的高瓦片会向上伸入视口，左侧的宽瓦片会向右伸入视口
+    glm::vec2 viewMin = camera.screenToWorld({0.0f, 0.0f}) - offset - glm::vec2(maxOverhang.x, 0.0f);
+    glm::vec2 viewMax = camera.screenToWorld(camera.getViewportSize()) - offset + glm::vec2(0.0f, maxOverhang.y);
+    glm::ivec2 first = glm::ivec2(glm::floor(viewMin / glm::vec2(tileSize)));
+    glm::ivec2 last = glm::ivec2(glm::floor(viewMax / glm::vec2(tileSize))) + 1;
+    first = glm::clamp(first, glm::ivec2(0), mapSize);
+    last = glm::clamp(last, first, mapSize);
+    return {first, last};
+}
+
+glm::vec2 getTileLocalPosition(glm::ivec2 pos, const TileInfo &tileInfo, glm::ivec2 tileSize) {
+    glm::vec2 position = {static_cast<float>(pos.x) * tileSize.x, static_cast<float>(pos.y) * tileSize.y};
+    // 如果图片的大小与瓦片的大小不一致，需要调整 y 坐标 (瓦片层的对齐点是左下角)
+    const auto &sourceRect = tileInfo.sprite.getSourceRect();
+    if (sourceRect.has_value() && static_cast<int>(sourceRect->h) != tileSize.y) {
+        position.y -= sourceRect->h - static_cast<float>(tileSize.y);
+    }
+    return position;
+}
+
+void drawTiles(render::Renderer &renderer, const render::Camera &camera, const std::vector<TileInfo> &tiles, glm::ivec2 tileSize,
+               glm::ivec2 mapSize, glm::vec2 offset, glm::vec2 maxOverhang, render::RenderLayer layer) {
+    // 只遍历与视口相交的瓦片，开销与屏幕大小而不是地图大小成正比
+    auto [first, last] = getVisibleTileRange(camera, offset, tileSize, mapSize, maxOverhang);
+    for (int y = first.y; y < last.y; ++y) {
+        for (int x = first.x; x < last.x; ++x) {
+            size_t index = static_cast<size_t>(y) * mapSize.x + x;
+            // 检查索引有效性以及瓦片是否需要渲染
+            if (index < tiles.size() && tiles[index].type != TileType::EMPTY) {
+                const auto &tileInfo = tiles[index];
+                // 计算该瓦片在世界中的左上角位置 (drawSprite 预期接收左上角坐标)
+                glm::vec2 tileLeftTopPos = offset + getTileLocalPosition({x, y}, tileInfo, tileSize);
+                renderer.drawSprite(camera, tileInfo.sprite, tileLeftTopPos, glm::vec2(1.0f), 0.0, layer);
+            }
+        }
+    }
+}
+
 TileLayerComponent::TileLayerComponent(glm::ivec2 tileSize, glm::ivec2 mapSize, std::vector<TileInfo> &&tiles)
     : m_tileSize(tileSize), m_mapSize(mapSize), m_tiles(std::move(tiles)) {
     if (m_tiles.size() != static_cast<size_t>(m_mapSize.x * m_mapSize.y)) {
@@ -14,6 +66,9 @@ TileLayerComponent::TileLayerComponent(glm::ivec2 tileSize, glm::ivec2 mapSize,
         m_tiles.clear();
         m_mapSize = {0, 0};
     }
+    for (const auto &tileInfo : m_tiles) {
+        m_maxOverhang = glm::max(m_maxOverhang, getTileOverhang(tileInfo, m_tileSize));
+    }
     spdlog::trace("TILELAYERCOMPONENT::构造完成");
 }
 
@@ -24,28 +79,123 @@ void TileLayerComponent::init() {
 
 void TileLayerComponent::render(engine::core::Context &context) {
     if (m_tileSize.x <= 0 || m_tileSize.y <= 0) return;
-    // 遍历所有瓦片
-    for (int y = 0; y < m_mapSize.y; ++y) {
-        for (int x = 0; x < m_mapSize.x; ++x) {
-            size_t index = static_cast<size_t>(y) * m_mapSize.x + x;
-            // 检查索引有效性以及瓦片是否需要渲染
-            if (index < m_tiles.size() && m_tiles[index].type != TileType::EMPTY) {
-                const auto &tileInfo = m_tiles[index];
-                // 计算该瓦片在世界中的左上角位置 (drawSprite 预期接收左上角坐标)
-                glm::vec2 tileLeftTopPos = {
-                    m_offset.x + static_cast<float>(x) * m_tileSize.x,
-                    m_offset.y + static_cast<float>(y) * m_tileSize.y};
-                // 但如果图片的大小与瓦片的大小不一致，需要调整 y 坐标 (瓦片层的对齐点是左下角)
-                if (static_cast<int>(tileInfo.sprite.getSourceRect()->h) != m_tileSize.y) {
-                    tileLeftTopPos.y -= (tileInfo.sprite.getSourceRect()->h - static_cast<float>(m_tileSize.y));
-                }
-                // 执行绘制
-                context.getRenderer().drawSprite(context.getCamera(), tileInfo.sprite, tileLeftTopPos);
+    // 按 Y 排序的图层 (装饰物) 需要每个瓦片单独参与排序，烘焙成区块会破坏与单位的遮挡关系
+    if (m_isChunkCacheEnabled && !render::isDepthSorted(m_layer)) {
+        renderChunks(context);
+    } else {
+        renderTiles(context);
+    }
+}
+
+void TileLayerComponent::clean() {
+    releaseChunks();
+}
+
+void TileLayerComponent::renderTiles(engine::core::Context &context) const {
+    drawTiles(context.getRenderer(), context.getCamera(), m_tiles, m_tileSize, m_mapSize, m_offset, m_maxOverhang, m_layer);
+}
+
+void TileLayerComponent::renderChunks(engine::core::Context &context) {
+    ENGINE_TRACE_ZONE("TileLayerComponent::renderChunks");
+    if (m_chunks.empty()) createChunks();
+    auto &renderer = context.getRenderer();
+    const auto &camera = context.getCamera();
+    const glm::vec2 viewportSize = camera.getViewportSize();
+    m_renderer = &renderer;
+    auto [first, last] = getVisibleTileRange(camera, m_offset, m_tileSize, m_mapSize, m_maxOverhang);
+    if (first.x >= last.x || first.y >= last.y) return;
+    // 包含可见瓦片的区块，再按区块的实际范围逐个裁剪
+    glm::ivec2 firstChunk = first / CHUNK_SIZE;
+    glm::ivec2 lastChunk = (last - 1) / CHUNK_SIZE + 1;
+    for (int cy = firstChunk.y; cy < lastChunk.y; ++cy) {
+        for (int cx = firstChunk.x; cx < lastChunk.x; ++cx) {
+            auto &chunk = m_chunks[static_cast<size_t>(cy) * m_chunkCount.x + cx];
+            if (chunk.size.x <= 0.0f || chunk.size.y <= 0.0f) continue;
+            glm::vec2 worldPos = m_offset + chunk.position;
+            glm::vec2 screenPos = camera.worldToScreen(worldPos);
+            if (screenPos.x >= viewportSize.x || screenPos.y >= viewportSize.y ||
+                screenPos.x + chunk.size.x <= 0.0f || screenPos.y + chunk.size.y <= 0.0f) {
+                continue; // 不可见的区块不烘焙也不绘制
             }
+            if (chunk.isDirty) bakeChunk(renderer, chunk, {cx, cy});
+            renderer.drawCaptureSprite(camera, chunk.targetID, worldPos, chunk.size, m_layer);
         }
     }
 }
 
+void TileLayerComponent::createChunks() {
+    m_chunkCount = (m_mapSize + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    m_chunks.assign(static_cast<size_t>(m_chunkCount.x) * m_chunkCount.y, Chunk{});
+    for (int cy = 0; cy < m_chunkCount.y; ++cy) {
+        for (int cx = 0; cx < m_chunkCount.x; ++cx) {
+            updateChunkBounds({cx, cy});
+        }
+    }
+}
+
+void TileLayerComponent::updateChunkBounds(glm::ivec2 chunkPos) {
+    auto &chunk = m_chunks[static_cast<size_t>(chunkPos.y) * m_chunkCount.x + chunkPos.x];
+    glm::ivec2 begin = chunkPos * CHUNK_SIZE;
+    glm::ivec2 end = glm::min(begin + CHUNK_SIZE, m_mapSize);
+    // 区块的范围是其中所有非空瓦片图片的包围盒 (高瓦片向上伸出，宽瓦片向右伸出)
+    glm::vec2 minPos = {0.0f, 0.0f};
+    glm::vec2 maxPos = {0.0f, 0.0f};
+    bool isEmpty = true;
+    for (int y = begin.y; y < end.y; ++y) {
+        for (int x = begin.x; x < end.x; ++x) {
+            const auto &tileInfo = m_tiles[static_cast<size_t>(y) * m_mapSize.x + x];
+            if (tileInfo.type == TileType::EMPTY) continue;
+            glm::vec2 leftTop = getTileLocalPosition({x, y}, tileInfo, m_tileSize);
+            const auto &sourceRect = tileInfo.sprite.getSourceRect();
+            glm::vec2 size = sourceRect.has_value() ? glm::vec2(sourceRect->w, sourceRect->h) : glm::vec2(m_tileSize);
+            minPos = isEmpty ? leftTop : glm::min(minPos, leftTop);
+            maxPos = isEmpty ? leftTop + size : glm::max(maxPos, leftTop + size);
+            isEmpty = false;
+        }
+    }
+    chunk.position = glm::floor(minPos);
+    chunk.size = isEmpty ? glm::vec2(0.0f) : glm::ceil(maxPos) - chunk.position;
+    chunk.isDirty = true;
+}
+
+void TileLayerComponent::bakeChunk(engine::render::Renderer &renderer, Chunk &chunk, glm::ivec2 chunkPos) {
+    if (chunk.targetID == 0) chunk.targetID = renderer.createCaptureTarget();
+    glm::ivec2 begin = chunkPos * CHUNK_SIZE;
+    glm::ivec2 end = glm::min(begin + CHUNK_SIZE, m_mapSize);
+    // 截图中使用相对截图左上角的坐标，按行主序录制，重叠的瓦片与逐个绘制时的覆盖关系一致
+    renderer.beginCapture(chunk.targetID, chunk.size);
+    for (int y = begin.y; y < end.y; ++y) {
+        for (int x = begin.x; x < end.x; ++x) {
+            const auto &tileInfo = m_tiles[static_cast<size_t>(y) * m_mapSize.x + x];
+            if (tileInfo.type == TileType::EMPTY) continue;
+            renderer.drawUISprite(tileInfo.sprite, getTileLocalPosition({x, y}, tileInfo, m_tileSize) - chunk.position);
+        }
+    }
+    renderer.endCapture();
+    chunk.isDirty = false;
+}
+
+void TileLayerComponent::releaseChunks() {
+    if (m_renderer) {
+        for (const auto &chunk : m_chunks) {
+            if (chunk.targetID != 0) m_renderer->releaseCaptureTarget(chunk.targetID);
+        }
+    }
+    m_chunks.clear();
+    m_chunkCount = {0, 0};
+}
+
+void TileLayerComponent::setLayer(render::RenderLayer layer) {
+    m_layer = layer;
+    if (render::isDepthSorted(m_layer)) releaseChunks();
+}
+
+void TileLayerComponent::setChunkCacheEnabled(bool enabled) {
+    if (m_isChunkCacheEnabled == enabled) return;
+    m_isChunkCacheEnabled = enabled;
+    if (!enabled) releaseChunks();
+}
+
 const TileInfo *TileLayerComponent::getTileInfoAt(glm::ivec2 pos) const {
     if (pos.x < 0 || pos.x >= m_mapSize.x || pos.y < 0 || pos.y >= m_mapSize.y) {
         spdlog::warn("TILELAYERCOMPONENT::getTileInfoAt::瓦片坐标越界: ({}, {})", pos.x, pos.y);
@@ -71,4 +221,16 @@ TileType TileLayerComponent::getTileTypeAtWorldPos(const glm::vec2 &worldPos) co
     int tileY = static_cast<int>(std::floor(relativePos.y / m_tileSize.y));
     return getTileTypeAt(glm::ivec2{tileX, tileY});
 }
+
+bool TileLayerComponent::setTileAt(glm::ivec2 pos, TileInfo tileInfo) {
+    if (pos.x < 0 || pos.x >= m_mapSize.x || pos.y < 0 || pos.y >= m_mapSize.y) {
+        spdlog::warn("TILELAYERCOMPONENT::setTileAt::瓦片坐标越界: ({}, {})", pos.x, pos.y);
+        return false;
+    }
+    m_maxOverhang = glm::max(m_maxOverhang, getTileOverhang(tileInfo, m_tileSize));
+    m_tiles[static_cast<size_t>(pos.y) * m_mapSize.x + pos.x] = std::move(tileInfo);
+    // 只有所在区块需要重新烘焙 (区块的范围包含向外伸出的部分)
+    if (!m_chunks.empty()) updateChunkBounds(pos / CHUNK_SIZE);
+    return true;
+}
 } // namespace engine::component
\ No newline at end of file
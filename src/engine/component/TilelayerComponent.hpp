@@ -1,11 +1,14 @@
 #pragma once
+#include "../render/RenderCommand.hpp"
 #include "../render/Sprite.hpp"
 #include "Component.hpp"
 #include <glm/vec2.hpp>
+#include <utility>
 #include <vector>
 
 namespace engine::render {
-class Sprite;
+class Camera;
+class Renderer;
 } // namespace engine::render
 
 namespace engine::core {
@@ -36,21 +39,82 @@ struct TileInfo {
     TileInfo(render::Sprite s = render::Sprite(), TileType t = TileType::EMPTY) : sprite(std::move(s)), type(t) {}
 };
 
+/**
+ * @brief 获取瓦片图片超出瓦片格子的部分 (瓦片层的对齐点是左下角，图片较高时向上伸出、较宽时向右伸出)
+ * @param tileInfo 瓦片信息
+ * @param tileSize 单个瓦片尺寸（像素）
+ * @return x 为向右伸出的宽度，y 为向上伸出的高度 (不伸出时为 0)
+ */
+glm::vec2 getTileOverhang(const TileInfo &tileInfo, glm::ivec2 tileSize);
+/**
+ * @brief 计算与相机视口相交的瓦片范围，渲染时只需遍历该范围
+ * @param camera 相机
+ * @param offset 瓦片层在世界中的偏移量
+ * @param tileSize 单个瓦片尺寸（像素）
+ * @param mapSize 地图尺寸（瓦片数）
+ * @param maxOverhang 图层中瓦片的最大伸出量 (getTileOverhang)，视口下方与左侧相应多包含几行 / 几列
+ * @return 瓦片坐标范围 [first, second)，已限制在地图内 (不可见时为空范围)
+ */
+std::pair<glm::ivec2, glm::ivec2> getVisibleTileRange(const render::Camera &camera, glm::vec2 offset, glm::ivec2 tileSize,
+                                                      glm::ivec2 mapSize, glm::vec2 maxOverhang);
+/**
+ * @brief 计算瓦片左上角相对图层偏移量的位置 (瓦片层的对齐点是左下角，图片比瓦片高时向上伸出)
+ * @param pos 瓦片坐标
+ * @param tileInfo 瓦片信息
+ * @param tileSize 单个瓦片尺寸（像素）
+ */
+glm::vec2 getTileLocalPosition(glm::ivec2 pos, const TileInfo &tileInfo, glm::ivec2 tileSize);
+/**
+ * @brief 逐个录制与视口相交的非空瓦片 (TileLayerComponent 不使用区块缓存时与 ECS 的瓦片层系统共用)
+ * @param renderer 渲染器
+ * @param camera 相机
+ * @param tiles 瓦片信息 (行主序, index = y * mapSize.x + x)
+ * @param tileSize 单个瓦片尺寸（像素）
+ * @param mapSize 地图尺寸（瓦片数）
+ * @param offset 瓦片层在世界中的偏移量
+ * @param maxOverhang 图层中瓦片的最大伸出量
+ * @param layer 渲染图层
+ */
+void drawTiles(render::Renderer &renderer, const render::Camera &camera, const std::vector<TileInfo> &tiles, glm::ivec2 tileSize,
+               glm::ivec2 mapSize, glm::vec2 offset, glm::vec2 maxOverhang, render::RenderLayer layer);
+
 /**
  * @brief 管理和渲染瓦片地图层。
  *
  * 存储瓦片地图的布局、每个瓦片的精灵信息和类型。
  * 负责在渲染阶段绘制可见的瓦片。
+ *
+ * 默认把图层按 CHUNK_SIZE x CHUNK_SIZE 个瓦片分块，每块第一次可见时烘焙到一张截图纹理中，
+ * 之后每帧只为可见的区块录制一条绘制命令。区块只在其中的瓦片通过 setTileAt 改变后重新烘焙。
  */
 class TileLayerComponent final : public Component {
     friend class engine::object::GameObject;
 
+  public:
+    static constexpr ComponentType TYPE = ComponentType::TileLayer; ///< @brief 编译期组件ID
+    static constexpr int CHUNK_SIZE = 16;                           ///< @brief 区块边长（瓦片数）
+
   private:
-    glm::ivec2 m_tileSize;             ///< @brief 单个瓦片尺寸（像素）
-    glm::ivec2 m_mapSize;              ///< @brief 地图尺寸（瓦片数）
-    std::vector<TileInfo> m_tiles;     ///< @brief 存储所有瓦片信息 (按"行主序"存储, index = y * map_width_ + x)
-    glm::vec2 m_offset = {0.0f, 0.0f}; ///< @brief 瓦片层在世界中的偏移量 (瓦片层通常不需要缩放及旋转，因此不引入Transform组件) offset_ 最好也保持默认的0，以免增加不必要的复杂性
-    bool m_isHidden = false;           ///< @brief 是否隐藏（不渲染）
+    /// @brief 一块烘焙好的瓦片区域
+    struct Chunk {
+        Uint32 targetID = 0;               ///< @brief 截图渲染目标ID，0 表示尚未分配
+        glm::vec2 position = {0.0f, 0.0f}; ///< @brief 截图左上角相对图层偏移量的位置 (包含向上伸出的高瓦片)
+        glm::vec2 size = {0.0f, 0.0f};     ///< @brief 截图尺寸（像素），为 0 表示区块中没有非空瓦片
+        bool isDirty = true;               ///< @brief 是否需要 (重新) 烘焙
+    };
+
+    glm::ivec2 m_tileSize;                                     ///< @brief 单个瓦片尺寸（像素）
+    glm::ivec2 m_mapSize;                                      ///< @brief 地图尺寸（瓦片数）
+    std::vector<TileInfo> m_tiles;                             ///< @brief 存储所有瓦片信息 (按"行主序"存储, index = y * map_width_ + x)
+    glm::vec2 m_offset = {0.0f, 0.0f};                         ///< @brief 瓦片层在世界中的偏移量 (瓦片层通常不需要缩放及旋转，因此不引入Transform组件) offset_ 最好也保持默认的0，以免增加不必要的复杂性
+    bool m_isHidden = false;                                   ///< @brief 是否隐藏（不渲染）
+    render::RenderLayer m_layer = render::RenderLayer::Ground; ///< @brief 渲染图层 (地面 / 装饰 / 前景瓦片)
+    glm::vec2 m_maxOverhang = {0.0f, 0.0f};                    ///< @brief 瓦片的最大伸出量，用于计算可见范围 (只增不减)
+
+    bool m_isChunkCacheEnabled = true;              ///< @brief 是否使用区块缓存，关闭时每帧逐个绘制瓦片 (按 Y 排序的图层始终逐个绘制)
+    std::vector<Chunk> m_chunks;                    ///< @brief 区块 (行主序)，第一次渲染时创建
+    glm::ivec2 m_chunkCount = {0, 0};               ///< @brief 两个方向上的区块数
+    engine::render::Renderer *m_renderer = nullptr; ///< @brief 分配了截图的渲染器，clean 时用于释放截图
 
   public:
     TileLayerComponent() = default;
@@ -80,22 +144,44 @@ class TileLayerComponent final : public Component {
      * @return TileType 瓦片类型，如果坐标无效或对应空瓦片则返回 TileType::EMPTY
      */
     TileType getTileTypeAtWorldPos(const glm::vec2 &worldPos) const;
+    /**
+     * @brief 设置瓦片，所在区块会在下一次渲染时重新烘焙
+     * @param pos 瓦片坐标 (0 <= x < map_size_.x, 0 <= y < map_size_.y)
+     * @param tileInfo 新的瓦片信息
+     * @return 坐标有效时返回 true
+     */
+    bool setTileAt(glm::ivec2 pos, TileInfo tileInfo);
 
     glm::ivec2 getTileSize() const { return m_tileSize; } ///< @brief 获取单个瓦片尺寸
     glm::ivec2 getMapSize() const { return m_mapSize; }   ///< @brief 获取地图尺寸
     glm::vec2 getWorldSize() const { return glm::vec2(m_mapSize.x * m_tileSize.x, m_mapSize.y * m_tileSize.y); }
-    const std::vector<TileInfo> &getTiles() const { return m_tiles; } ///< @brief 获取瓦片容器
-    const glm::vec2 &getOffset() const { return m_offset; }           ///< @brief 获取瓦片层的偏移量
-    bool isHidden() const { return m_isHidden; }                      ///< @brief 获取是否隐藏（不渲染）
+    const std::vector<TileInfo> &getTiles() const { return m_tiles; }  ///< @brief 获取瓦片容器
+    const glm::vec2 &getOffset() const { return m_offset; }            ///< @brief 获取瓦片层的偏移量
+    bool isHidden() const { return m_isHidden; }                       ///< @brief 获取是否隐藏（不渲染）
+    render::RenderLayer getLayer() const { return m_layer; }           ///< @brief 获取渲染图层
+    bool isChunkCacheEnabled() const { return m_isChunkCacheEnabled; } ///< @brief 获取是否使用区块缓存
 
     void setOffset(glm::vec2 offset) { m_offset = std::move(offset); } ///< @brief 设置瓦片层的偏移量
     void setHidden(bool hidden) { m_isHidden = hidden; }               ///< @brief 设置是否隐藏（不渲染）
+    void setLayer(render::RenderLayer layer);                          ///< @brief 设置渲染图层 (按 Y 排序的图层不使用区块缓存)
+    void setChunkCacheEnabled(bool enabled);                           ///< @brief 设置是否使用区块缓存 (关闭时释放已烘焙的截图)
+    bool needsUpdate() const override { return false; } ///< @brief update 为空，只在渲染阶段工作
 
   protected:
     // 核心循环方法
     void init() override;
     void update(float, engine::core::Context &) override {}
     void render(engine::core::Context &context) override;
+    void clean() override;
+
+  private:
+    void renderTiles(engine::core::Context &context) const; ///< @brief 逐个录制瓦片 (不使用区块缓存)
+    void renderChunks(engine::core::Context &context);      ///< @brief 烘焙需要更新的可见区块，并录制可见区块
+    void createChunks();                                    ///< @brief 按地图尺寸创建区块并计算范围
+    void updateChunkBounds(glm::ivec2 chunkPos);            ///< @brief 重新计算区块的截图位置与尺寸
+    /// @brief 把区块中的瓦片录制到它的截图中
+    void bakeChunk(engine::render::Renderer &renderer, Chunk &chunk, glm::ivec2 chunkPos);
+    void releaseChunks(); ///< @brief 释放所有区块的截图
 };
 
 } // namespace engine::component
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "TransformComponent.hpp"
 #include "../object/GameObject.hpp"
+#include "../scene/Scene.hpp"
 #include "SpriteComponent.hpp"
 
 namespace engine::component {
@@ -13,8 +14,24 @@ void TransformComponent::setScale(glm::vec2 scale) {
         }
     }
 }
+void TransformComponent::setPosition(glm::vec2 position) {
+    m_position = std::move(position);
+    onMoved();
+}
+
 void TransformComponent::translate(const glm::vec2 &offset) {
     m_position += offset;
+    onMoved();
+}
+
+void TransformComponent::onMoved() {
+    if (m_isMoved) return; // 本次更新已通知过
+    auto *scene = m_owner ? m_owner->getScene() : nullptr;
+    if (scene && scene->onTransformMoved(*m_owner)) {
+        m_isMoved = true;
+    } else {
+        resetInterpolation(); // 尚未加入场景，还没有被渲染过
+    }
 }
 
 } // namespace engine::component
\ No newline at end of file
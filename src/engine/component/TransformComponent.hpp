@@ -15,14 +15,23 @@ namespace engine::component {
  * @note 该组件为final类，不允许被继承
  * @note 旋转角度使用角度制（度）作为单位，而不是弧度
  * @note 缩放默认为(1.0f, 1.0f)，表示原始大小
+ * @note 位置应通过 setPosition / translate 修改：不在更新列表中的对象 (只有 Transform + Sprite 等) 不会每帧记录插值起点，
+ *       位置被修改时通知所在场景，由场景在下一次更新开始时记录
  */
 class TransformComponent final : public Component {
     friend class engine::object::GameObject; // 友元不能继承，必须每个子类单独添加
 
   public:
-    glm::vec2 m_position = {0.0f, 0.0f}; ///< @brief 对象在2D空间中的位置坐标
-    glm::vec2 m_scale = {1.0f, 1.0f};    ///< @brief 对象在X和Y轴上的缩放比例
-    float m_rotation = 0.0f;             ///< @brief 对象的旋转角度（角度制）
+    static constexpr ComponentType TYPE = ComponentType::Transform; ///< @brief 编译期组件ID
+
+  private:
+    glm::vec2 m_position = {0.0f, 0.0f};         ///< @brief 对象在2D空间中的位置坐标 (只能通过 setPosition / translate 修改)
+    glm::vec2 m_scale = {1.0f, 1.0f};            ///< @brief 对象在X和Y轴上的缩放比例
+    float m_rotation = 0.0f;                     ///< @brief 对象的旋转角度（角度制）
+    glm::vec2 m_previousPosition = {0.0f, 0.0f}; ///< @brief 上一次模拟更新前的位置，用于渲染插值
+    bool m_isMoved = false;                      ///< @brief 本次更新中位置已被修改，下一次更新开始时会记录插值起点 (避免重复通知场景)
+
+  public:
 
     /**
      * @brief 构造函数
@@ -31,7 +40,7 @@ class TransformComponent final : public Component {
      * @param rotation 初始旋转角度（角度制），默认为0度
      */
     TransformComponent(glm::vec2 position = {0.0f, 0.0f}, glm::vec2 scale = {1.0f, 1.0f}, float rotation = 0.0f)
-        : m_position(std::move(position)), m_scale(std::move(scale)), m_rotation(rotation) {}
+        : m_position(position), m_scale(std::move(scale)), m_rotation(rotation), m_previousPosition(std::move(position)) {}
 
     TransformComponent(const TransformComponent &) = delete;
     TransformComponent &operator=(const TransformComponent &) = delete;
@@ -41,13 +50,31 @@ class TransformComponent final : public Component {
     const glm::vec2 &getPosition() const { return m_position; }
     float getRotation() const { return m_rotation; }
     const glm::vec2 &getScale() const { return m_scale; }
-    void setPosition(glm::vec2 position) { m_position = std::move(position); }
+    void setPosition(glm::vec2 position);
     void setRotation(float rotation) { m_rotation = rotation; }
     void setScale(glm::vec2 scale);
 
     void translate(const glm::vec2 &offset);
 
+    /// @brief 记录当前位置作为插值起点，由 GameObject (活跃对象) 或 Scene (被移动的非活跃对象) 在每次模拟更新前调用
+    void savePreviousPosition() {
+        m_previousPosition = m_position;
+        m_isMoved = false;
+    }
+    /// @brief 丢弃插值起点，使下一次渲染直接出现在当前位置（瞬移、重生、加入场景等情况）
+    void resetInterpolation() { savePreviousPosition(); }
+    /**
+     * @brief 获取渲染用的插值位置
+     * @param alpha 渲染插值系数，范围 [0, 1]
+     * @return 上一次与当前模拟位置之间的混合结果
+     */
+    glm::vec2 getInterpolatedPosition(float alpha) const { return m_previousPosition + (m_position - m_previousPosition) * alpha; }
+    bool needsUpdate() const override { return false; } ///< @brief update 为空，位置由其他组件或游戏逻辑修改
+
   private:
     void update(float, engine::core::Context &) override {}
+    void reset() override { resetInterpolation(); } ///< @brief 回收到对象池时丢弃插值起点
+    /// @brief 位置被修改后调用：通知所在场景在下一次更新开始时记录插值起点，不在场景中时直接丢弃插值起点
+    void onMoved();
 };
 } // namespace engine::component
\ No newline at end of file
@@ -72,6 +72,24 @@ void Config::fromJson(const nlohmann::json &j) {
             spdlog::warn("CONFIG::fromJson::目标 FPS 不能为负数. 设置为 0 ( 无限制 )");
             m_targetFPS = 0;
         }
+        m_precisePacing = perf_config.value("precise_pacing", m_precisePacing);
+        m_fixedTimestepEnabled = perf_config.value("fixed_timestep", m_fixedTimestepEnabled);
+        m_fixedUpdateFPS = perf_config.value("fixed_update_fps", m_fixedUpdateFPS);
+        if (m_fixedUpdateFPS <= 0) {
+            spdlog::warn("CONFIG::fromJson::固定步长频率必须大于 0. 设置为 60");
+            m_fixedUpdateFPS = 60;
+        }
+        m_maxFixedSteps = perf_config.value("max_fixed_steps", m_maxFixedSteps);
+        if (m_maxFixedSteps < 1) {
+            spdlog::warn("CONFIG::fromJson::单帧最大模拟步数不能小于 1. 设置为 1");
+            m_maxFixedSteps = 1;
+        }
+        m_workerThreads = perf_config.value("worker_threads", m_workerThreads);
+        if (m_workerThreads < 0) {
+            spdlog::warn("CONFIG::fromJson::工作线程数不能为负数. 设置为 0 ( 自动 )");
+            m_workerThreads = 0;
+        }
+        m_pipelinedRender = perf_config.value("pipelined_render", m_pipelinedRender);
     }
     if (j.contains("audio")) {
         const auto &audio_config = j["audio"];
@@ -107,7 +125,13 @@ nlohmann::ordered_json Config::toJson() const {
             {{"vsync", m_vsyncEnabled}
         }},
         {"performance", {
-            {"target_fps", m_targetFPS}
+            {"target_fps", m_targetFPS},
+            {"precise_pacing", m_precisePacing},
+            {"fixed_timestep", m_fixedTimestepEnabled},
+            {"fixed_update_fps", m_fixedUpdateFPS},
+            {"max_fixed_steps", m_maxFixedSteps},
+            {"worker_threads", m_workerThreads},
+            {"pipelined_render", m_pipelinedRender}
         }},
         {"audio", {
             {"music_volume", m_musicVolume}, 
@@ -25,6 +25,13 @@ class Config final {
 
     bool m_vsyncEnabled = true;
     int m_targetFPS = 60;
+    bool m_precisePacing = true; ///< @brief 精确限帧（休眠 + 自旋等待），关闭时只使用一次 SDL_DelayNS
+
+    bool m_fixedTimestepEnabled = true; ///< @brief 是否使用固定步长更新模拟（渲染帧率与模拟频率解耦）
+    int m_fixedUpdateFPS = 60;          ///< @brief 固定步长的模拟频率
+    int m_maxFixedSteps = 5;            ///< @brief 单帧最多追赶的模拟步数
+    int m_workerThreads = 0;            ///< @brief 线程池工作线程数，0 表示自动 (硬件线程数 - 1)
+    bool m_pipelinedRender = true;      ///< @brief 模拟线程录制下一帧的同时，主线程提交上一帧的绘制命令
 
     float m_musicVolume = 1.0f;
     float m_soundVolume = 1.0f;
@@ -16,8 +16,11 @@ Context::Context(
     engine::render::Camera &camera,
     engine::render::TextRenderer &textRenderer,
     engine::resource::ResourceManager &resourceManager,
-    engine::core::GameState &gameState) : m_dispatcher(dispatcher), m_inputManager(inputManager), m_renderer(renderer), m_camera(camera),
-                                          m_textRenderer(textRenderer), m_resourceManager(resourceManager), m_gameState(gameState) {
-    spdlog::trace("CONTEXT::上下文已创建，包括：输入管理器、渲染器、相机、资源管理器和游戏状态");
+    engine::core::GameState &gameState,
+    engine::core::JobSystem &jobSystem,
+    engine::ecs::PrototypeCache &prototypeCache) : m_dispatcher(dispatcher), m_inputManager(inputManager), m_renderer(renderer), m_camera(camera),
+                                                   m_textRenderer(textRenderer), m_resourceManager(resourceManager), m_gameState(gameState),
+                                                   m_jobSystem(jobSystem), m_prototypeCache(prototypeCache) {
+    spdlog::trace("CONTEXT::上下文已创建，包括：输入管理器、渲染器、相机、资源管理器、游戏状态、线程池和实体原型缓存");
 }
 } // namespace engine::core
\ No newline at end of file
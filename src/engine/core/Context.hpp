@@ -15,8 +15,13 @@ namespace engine::resource {
 class ResourceManager;
 }
 
+namespace engine::ecs {
+class PrototypeCache;
+}
+
 namespace engine::core {
 class GameState;
+class JobSystem;
 
 /**
  * @class Context
@@ -37,6 +42,8 @@ class Context final {
     engine::render::TextRenderer &m_textRenderer;         ///< 文本渲染器引用
     engine::resource::ResourceManager &m_resourceManager; ///< 资源管理器引用
     engine::core::GameState &m_gameState;                 ///< 游戏状态
+    engine::core::JobSystem &m_jobSystem;                 ///< 线程池
+    engine::ecs::PrototypeCache &m_prototypeCache;        ///< 实体原型缓存
 
   public:
     /**
@@ -48,6 +55,8 @@ class Context final {
      * @param textRenderer 文本渲染器引用
      * @param resourceManager 资源管理器引用
      * @param gameState 游戏状态引用
+     * @param jobSystem 线程池引用
+     * @param prototypeCache 实体原型缓存引用
      */
     Context(
         entt::dispatcher &dispatcher,
@@ -56,7 +65,9 @@ class Context final {
         engine::render::Camera &camera,
         engine::render::TextRenderer &textRenderer,
         engine::resource::ResourceManager &resourceManager,
-        engine::core::GameState &gameState);
+        engine::core::GameState &gameState,
+        engine::core::JobSystem &jobSystem,
+        engine::ecs::PrototypeCache &prototypeCache);
 
     Context(const Context &) = delete;
     Context &operator=(const Context &) = delete;
@@ -70,6 +81,8 @@ class Context final {
     engine::render::TextRenderer &getTextRenderer() const { return m_textRenderer; }            ///< @brief 获取文本渲染器
     engine::resource::ResourceManager &getResourceManager() const { return m_resourceManager; } ///< @brief 获取资源管理器
     engine::core::GameState &getGameState() const { return m_gameState; }                       ///< @brief 获取游戏状态
+    engine::core::JobSystem &getJobSystem() const { return m_jobSystem; }                       ///< @brief 获取线程池
+    engine::ecs::PrototypeCache &getPrototypeCache() const { return m_prototypeCache; }         ///< @brief 获取实体原型缓存
 };
 
 } // namespace engine::core
\ No newline at end of file
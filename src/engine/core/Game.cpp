@@ -1,5 +1,9 @@
 #include "Game.hpp"
 #include "../component/SpriteComponent.hpp"
+#include "../debug/FrameProfiler.hpp"
+#include "../debug/FrameReport.hpp"
+#include "../debug/Trace.hpp"
+#include "../ecs/PrototypeCache.hpp"
 #include "../component/TransformComponent.hpp"
 #include "../input/InputManager.hpp"
 #include "../object/GameObject.hpp"
@@ -7,16 +11,26 @@
 #include "../render/Renderer.hpp"
 #include "../render/TextRenderer.hpp"
 #include "../resource/ResourceManager.hpp"
+#include "../scene/Scene.hpp"
 #include "../scene/SceneManager.hpp"
 #include "../utils/Events.hpp"
 #include "Config.hpp"
 #include "GameState.hpp"
+#include "JobSystem.hpp"
 #include "Time.hpp"
 
 #include <SDL3/SDL.h>
+#include <entt/core/hashed_string.hpp>
 #include <entt/signal/dispatcher.hpp>
+#include <imgui.h>
+#include <imgui_impl_sdl3.h>
+#include <imgui_impl_sdlrenderer3.h>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+
 namespace engine::core {
 
 Game::Game() = default;
@@ -35,16 +49,72 @@ void Game::run() {
         spdlog::error("GAME::游戏初始化失败");
         return;
     }
+    if (m_isHeadless) {
+        runHeadless();
+        close();
+        return;
+    }
+    bool isFirstFrame = true;
     while (m_isRunning) {
+        ENGINE_TRACE_ZONE("Game::frame");
+        m_frameProfiler->beginFrame();
+        applyGameSpeed();
         m_time->update();
-        float deltaTime = static_cast<float>(m_time->getDeltaTime());
+        // 第一帧的间隔包含初始化耗时，不计入报告
+        if (!isFirstFrame) {
+            m_frameReport->recordFrame(m_time->getUnscaledDeltaTime(), m_time->getLimiterWaitTime());
+        }
+        isFirstFrame = false;
+        {
+            // SDL 事件只能在主线程轮询
+            debug::FrameProfiler::ScopedPhase phase(*m_frameProfiler, debug::ProfilePhase::Input);
+            m_inputManager->update();
+            m_gameState->syncWithSDL(); // 窗口尺寸同理，模拟线程只读取这里刷新的缓存
+        }
+        if (m_isPipelined) {
+            // 模拟线程推进本帧并录制命令，主线程同时提交上一帧录制的命令
+            startSimulation();
+            render();
+            waitForSimulation();
+            m_renderer->swapCommandLists();
+        } else {
+            simulate();
+            m_renderer->swapCommandLists();
+            render();
+        }
+        present();
+        m_frameProfiler->endFrame();
+    }
+    close();
+}
 
+void Game::runHeadless() {
+    spdlog::info("GAME::runHeadless::以无头模式运行, 最大帧数: {}", m_maxFrames);
+    // 模拟时间与真实时间无关: 每帧固定推进一个步长，不限帧、不渲染
+    float fixedDeltaTime = static_cast<float>(m_time->getFixedDeltaTime());
+    Uint64 startTicks = SDL_GetTicksNS();
+    int frameCount = 0;
+    while (m_isRunning) {
+        ENGINE_TRACE_ZONE("Game::frame");
+        Uint64 frameStart = SDL_GetTicksNS();
+        m_frameProfiler->beginFrame();
+        m_gameState->syncWithSDL();
         handleEvents();
-        update(deltaTime);
-        render();
-        // spdlog::info("FPS: {}", 1.0f / deltaTime);
+        update(fixedDeltaTime);
+        m_frameProfiler->endFrame();
+        m_frameReport->recordFrame(static_cast<double>(SDL_GetTicksNS() - frameStart) / 1000000000.0, 0.0);
+        ++frameCount;
+        if (m_maxFrames > 0 && frameCount >= m_maxFrames) {
+            m_isRunning = false;
+        }
     }
-    close();
+    double elapsed = static_cast<double>(SDL_GetTicksNS() - startTicks) / 1000000000.0;
+    spdlog::info("GAME::runHeadless::共模拟 {} 帧 ({:.2f} 秒游戏时间), 耗时 {:.3f} 秒", frameCount, frameCount * fixedDeltaTime, elapsed);
+}
+
+void Game::setHeadless(bool headless, int maxFrames) {
+    m_isHeadless = headless;
+    m_maxFrames = maxFrames;
 }
 
 void Game::registerSceneSetup(std::function<void(engine::core::Context &)> func) {
@@ -53,6 +123,8 @@ void Game::registerSceneSetup(std::function<void(engine::core::Context &)> func)
 }
 
 bool Game::init() {
+    debug::Trace::setThreadName("Main");
+    ENGINE_TRACE_ZONE("Game::init");
     spdlog::trace("GAME::init::初始化游戏...");
     if (!m_sceneSetupFunc) {
         spdlog::error("GAME::init::未注册场景设置函数，无法初始化 GameApp。");
@@ -69,51 +141,226 @@ bool Game::init() {
     if (!initTextRenderer()) return false;
     if (!initInputManager()) return false;
     if (!initGameState()) return false;
+    if (!initJobSystem()) return false;
+    if (!initPrototypeCache()) return false;
 
     if (!initContext()) return false;
     if (!initSceneManager()) return false;
+    if (!initFrameProfiler()) return false;
+    if (!initFrameReport()) return false;
+    if (!initImGui()) return false;
 
     m_sceneSetupFunc(*m_context);
+    if (!initSimulationThread()) return false;
     // 注册退出事件 (回调函数可以无参数，代表不使用事件结构体中的数据)
     m_dispatcher->sink<engine::utils::QuitEvent>().connect<&Game::onQuitEvent>(this);
+    m_inputManager->onAction(entt::hashed_string{"toggle_profiler"}).connect<&Game::onToggleProfiler>(this);
+    m_inputManager->onAction(entt::hashed_string{"dump_trace"}).connect<&Game::onDumpTrace>(this);
+    m_inputManager->onAction(entt::hashed_string{"cycle_game_speed"}).connect<&Game::onCycleGameSpeed>(this);
+    m_inputManager->onAction(entt::hashed_string{"dump_frame_report"}).connect<&Game::onDumpFrameReport>(this);
     m_isRunning = true;
     spdlog::trace("GAME::初始化成功。");
     return true;
 }
 
 void Game::handleEvents() {
-    m_inputManager->update();
+    ENGINE_TRACE_ZONE("Game::handleEvents");
+    {
+        debug::FrameProfiler::ScopedPhase phase(*m_frameProfiler, debug::ProfilePhase::Input);
+        m_inputManager->update();
+    }
+    debug::FrameProfiler::ScopedPhase phase(*m_frameProfiler, debug::ProfilePhase::HandleInput);
     m_sceneManager->handleInput();
 }
 
 void Game::update(float deltaTime) {
-    m_sceneManager->update(deltaTime);
+    ENGINE_TRACE_ZONE("Game::update");
+    {
+        debug::FrameProfiler::ScopedPhase phase(*m_frameProfiler, debug::ProfilePhase::Update);
+        m_sceneManager->update(deltaTime);
+    }
+    debug::FrameProfiler::ScopedPhase phase(*m_frameProfiler, debug::ProfilePhase::Dispatch);
     m_dispatcher->update();
 }
 
+void Game::simulate() {
+    ENGINE_TRACE_ZONE("Game::simulate");
+    {
+        debug::FrameProfiler::ScopedPhase phase(*m_frameProfiler, debug::ProfilePhase::HandleInput);
+        m_sceneManager->handleInput();
+    }
+    if (m_time->isFixedTimestepEnabled() || m_time->isMaxSpeed()) {
+        // 固定步长: 本帧累积的时间按固定步长执行 0~N 次模拟，剩余部分用于渲染插值
+        // (最大速度模式总是按固定步长推进，步数由帧预算决定)
+        float fixedDeltaTime = static_cast<float>(m_time->getFixedDeltaTime());
+        while (m_time->consumeFixedStep()) {
+            update(fixedDeltaTime);
+        }
+    } else {
+        // 变步长: 高倍速时把本帧时间拆成多个子步，避免单步过长导致碰撞穿透或攻击计时跳变
+        int substeps = std::max(static_cast<int>(std::ceil(m_time->getTimeScale())), 1);
+        float deltaTime = static_cast<float>(m_time->getDeltaTime()) / static_cast<float>(substeps);
+        for (int i = 0; i < substeps; ++i) {
+            update(deltaTime);
+        }
+    }
+    float alpha = static_cast<float>(m_time->getInterpolationAlpha());
+    m_renderer->setInterpolationAlpha(alpha);
+    m_camera->setInterpolationAlpha(alpha);
+    recordCommands();
+}
+
+void Game::recordCommands() {
+    ENGINE_TRACE_ZONE("Game::recordCommands");
+    debug::FrameProfiler::ScopedPhase phase(*m_frameProfiler, debug::ProfilePhase::Render);
+    m_renderer->beginRecording();
+    m_sceneManager->render();
+    m_renderer->endRecording();
+}
+
 void Game::render() {
+    ENGINE_TRACE_ZONE("Game::render");
+    debug::FrameProfiler::ScopedPhase phase(*m_frameProfiler, debug::ProfilePhase::Submit);
     m_renderer->clearScreen();
-    m_sceneManager->render();
+    m_renderer->submitCommands(*m_textRenderer);
+}
+
+void Game::present() {
+    renderDebugOverlay(); // 调试叠加层不计入任何阶段
+    debug::FrameProfiler::ScopedPhase phase(*m_frameProfiler, debug::ProfilePhase::Present);
     m_renderer->present();
 }
 
+void Game::renderDebugOverlay() {
+    if (!m_isImGuiInitialized || !m_frameProfiler->isVisible()) return;
+    ENGINE_TRACE_ZONE("Game::renderDebugOverlay");
+
+    ImGui_ImplSDLRenderer3_NewFrame();
+    ImGui_ImplSDL3_NewFrame();
+    ImGui::NewFrame();
+    m_frameProfiler->drawOverlay();
+    ImGui::Render();
+
+    // ImGui 使用窗口坐标，绘制时临时关闭逻辑分辨率缩放，绘制完再恢复
+    int logicalWidth, logicalHeight;
+    SDL_RendererLogicalPresentation mode;
+    SDL_GetRenderLogicalPresentation(m_SDLRenderer, &logicalWidth, &logicalHeight, &mode);
+    SDL_SetRenderLogicalPresentation(m_SDLRenderer, 0, 0, SDL_LOGICAL_PRESENTATION_DISABLED);
+    ImGui_ImplSDLRenderer3_RenderDrawData(ImGui::GetDrawData(), m_SDLRenderer);
+    SDL_SetRenderLogicalPresentation(m_SDLRenderer, logicalWidth, logicalHeight, mode);
+}
+
+void Game::simulationLoop() {
+    debug::Trace::setThreadName("Simulation");
+    while (true) {
+        {
+            std::unique_lock lock(m_simulationMutex);
+            m_simulationCondition.wait(lock, [this] { return m_simulationRequested || m_simulationExit; });
+            if (m_simulationExit) return;
+            m_simulationRequested = false;
+        }
+        simulate();
+        {
+            std::lock_guard lock(m_simulationMutex);
+            m_simulationFinished = true;
+        }
+        m_simulationCondition.notify_all();
+    }
+}
+
+void Game::startSimulation() {
+    {
+        std::lock_guard lock(m_simulationMutex);
+        m_simulationRequested = true;
+        m_simulationFinished = false;
+    }
+    m_simulationCondition.notify_all();
+}
+
+void Game::waitForSimulation() {
+    ENGINE_TRACE_ZONE("Game::waitForSimulation");
+    std::unique_lock lock(m_simulationMutex);
+    m_simulationCondition.wait(lock, [this] { return m_simulationFinished; });
+}
+
+void Game::stopSimulationThread() {
+    if (!m_simulationThread.joinable()) return;
+    {
+        std::lock_guard lock(m_simulationMutex);
+        m_simulationExit = true;
+    }
+    m_simulationCondition.notify_all();
+    m_simulationThread.join();
+    m_isPipelined = false;
+}
+
+void Game::applyGameSpeed() {
+    m_time->setMaxSpeed(m_gameState->isMaxGameSpeed());
+    if (!m_gameState->isMaxGameSpeed()) {
+        m_time->setTimeScale(m_gameState->getGameSpeed());
+    }
+}
+
+void Game::dumpFrameReport() {
+    debug::FrameReport::RunInfo info;
+    const auto &sceneStack = m_sceneManager->getSceneStack();
+    if (!sceneStack.empty()) {
+        info.sceneName = sceneStack.back()->getName();
+    }
+    for (const auto &scene : sceneStack) {
+        info.scenes.push_back({std::string(scene->getName()), scene->getGameObjects().size(), scene->getEntityCount()});
+    }
+    info.targetFPS = m_isHeadless ? 0 : m_config->m_targetFPS;
+    info.vsync = !m_isHeadless && m_config->m_vsyncEnabled;
+    info.fixedTimestep = m_time->isFixedTimestepEnabled();
+    info.pipelined = m_isPipelined;
+    info.headless = m_isHeadless;
+    info.gameSpeed = m_gameState->getGameSpeed();
+    m_frameReport->dump(info);
+}
+
 void Game::close() {
     spdlog::trace("GAME::关闭游戏...");
 
     m_dispatcher->sink<engine::utils::QuitEvent>().disconnect<&Game::onQuitEvent>(this);
+    m_inputManager->onAction(entt::hashed_string{"toggle_profiler"}).disconnect<&Game::onToggleProfiler>(this);
+    m_inputManager->onAction(entt::hashed_string{"dump_trace"}).disconnect<&Game::onDumpTrace>(this);
+    m_inputManager->onAction(entt::hashed_string{"cycle_game_speed"}).disconnect<&Game::onCycleGameSpeed>(this);
+    m_inputManager->onAction(entt::hashed_string{"dump_frame_report"}).disconnect<&Game::onDumpFrameReport>(this);
+    stopSimulationThread(); // 模拟线程可能仍持有场景，必须先于场景关闭
+    if (m_frameReport->getFrameCount() > 0) {
+        dumpFrameReport(); // 场景关闭前导出，报告中才有对象数量
+    }
     m_sceneManager->close();
+    m_jobSystem.reset(); // 场景关闭后不会再有任务提交
+    m_renderer->clean(); // 截图纹理必须在 SDL_Renderer 之前销毁
+    m_prototypeCache.reset();
+
+    if (m_isImGuiInitialized) {
+        ImGui_ImplSDLRenderer3_Shutdown();
+        ImGui_ImplSDL3_Shutdown();
+        ImGui::DestroyContext();
+        m_isImGuiInitialized = false;
+    }
     m_resourceManager.reset();
 
     if (m_SDLRenderer) {
         SDL_DestroyRenderer(m_SDLRenderer);
         m_SDLRenderer = nullptr;
     }
+    if (m_headlessSurface) {
+        SDL_DestroySurface(m_headlessSurface);
+        m_headlessSurface = nullptr;
+    }
     if (m_window) {
         SDL_DestroyWindow(m_window);
         m_window = nullptr;
     }
     SDL_Quit();
     m_isRunning = false;
+#ifdef ENGINE_ENABLE_TRACE
+    debug::Trace::dump(); // 退出时导出剩余的追踪事件
+#endif
 }
 /// @}
 
@@ -142,6 +389,7 @@ bool Game::initConfig() {
 }
 
 bool Game::initWindow() {
+    if (m_isHeadless) return initHeadlessRenderer();
     if (!SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO)) {
         spdlog::error("GAME::initWindow::SDL初始化失败: {}", SDL_GetError());
         return false;
@@ -168,6 +416,28 @@ bool Game::initWindow() {
     return true;
 }
 
+bool Game::initHeadlessRenderer() {
+    // 无头模式只需要事件子系统 (用于接收退出信号)，不初始化视频和音频
+    if (!SDL_Init(SDL_INIT_EVENTS)) {
+        spdlog::error("GAME::initHeadlessRenderer::SDL初始化失败: {}", SDL_GetError());
+        return false;
+    }
+    // 用离屏表面承载软件渲染器，纹理加载、尺寸查询等依赖 SDL_Renderer 的功能依然可用
+    m_headlessSurface = SDL_CreateSurface(m_config->m_windowWidth / 2, m_config->m_windowHeight / 2, SDL_PIXELFORMAT_RGBA8888);
+    if (!m_headlessSurface) {
+        spdlog::error("GAME::initHeadlessRenderer::离屏表面创建失败: {}", SDL_GetError());
+        return false;
+    }
+    m_SDLRenderer = SDL_CreateSoftwareRenderer(m_headlessSurface);
+    if (!m_SDLRenderer) {
+        spdlog::error("GAME::initHeadlessRenderer::软件渲染器创建失败: {}", SDL_GetError());
+        return false;
+    }
+    SDL_SetRenderLogicalPresentation(m_SDLRenderer, m_config->m_windowWidth / 2, m_config->m_windowHeight / 2, SDL_LOGICAL_PRESENTATION_LETTERBOX);
+    spdlog::trace("GAME::initHeadlessRenderer::无头模式渲染器初始化成功");
+    return true;
+}
+
 bool Game::initTime() {
     try {
         m_time = std::make_unique<Time>(m_config->m_targetFPS);
@@ -175,8 +445,12 @@ bool Game::initTime() {
         spdlog::error("GAME::initTime::时间管理器初始化失败: {}", e.what());
         return false;
     }
-    m_time->setTargetFPS(m_config->m_targetFPS);
-    spdlog::trace("GAME::initTime::时间管理器初始化成功, FPS: {}", m_config->m_targetFPS);
+    m_time->setTargetFPS(m_isHeadless ? 0 : m_config->m_targetFPS); // 无头模式不限帧
+    m_time->setPrecisePacing(m_config->m_precisePacing);
+    m_time->setFixedUpdateFPS(m_config->m_fixedUpdateFPS);
+    m_time->setMaxFixedSteps(m_config->m_maxFixedSteps);
+    m_time->setFixedTimestepEnabled(m_config->m_fixedTimestepEnabled);
+    spdlog::trace("GAME::initTime::时间管理器初始化成功, FPS: {}, 固定步长: {} ({} Hz)", m_config->m_targetFPS, m_config->m_fixedTimestepEnabled, m_config->m_fixedUpdateFPS);
     return true;
 }
 
@@ -212,7 +486,7 @@ bool Game::initCamera() {
 
 bool Game::initTextRenderer() {
     try {
-        m_textRenderer = std::make_unique<render::TextRenderer>(m_SDLRenderer, m_resourceManager.get());
+        m_textRenderer = std::make_unique<render::TextRenderer>(m_SDLRenderer, m_resourceManager.get(), m_renderer.get());
     } catch (const std::exception &e) {
         spdlog::error("GAME::initTextRenderer::文本渲染器初始化失败: {}", e.what());
         return false;
@@ -240,6 +514,27 @@ bool Game::initGameState() {
     return true;
 }
 
+bool Game::initJobSystem() {
+    try {
+        m_jobSystem = std::make_unique<JobSystem>(m_config->m_workerThreads);
+    } catch (const std::exception &e) {
+        spdlog::error("GAME::initJobSystem::线程池初始化失败: {}", e.what());
+        return false;
+    }
+    spdlog::trace("GAME::initJobSystem::线程池初始化成功, 工作线程数: {}", m_jobSystem->getWorkerCount());
+    return true;
+}
+
+bool Game::initPrototypeCache() {
+    try {
+        m_prototypeCache = std::make_unique<ecs::PrototypeCache>(*m_resourceManager);
+    } catch (const std::exception &e) {
+        spdlog::error("GAME::initPrototypeCache::实体原型缓存初始化失败: {}", e.what());
+        return false;
+    }
+    return true;
+}
+
 bool Game::initContext() {
     try {
         m_context = std::make_unique<engine::core::Context>(
@@ -249,7 +544,9 @@ bool Game::initContext() {
             *m_camera,
             *m_textRenderer,
             *m_resourceManager,
-            *m_gameState);
+            *m_gameState,
+            *m_jobSystem,
+            *m_prototypeCache);
     } catch (const std::exception &e) {
         spdlog::error("GAME::initContext::上下文初始化失败: {}", e.what());
         return false;
@@ -266,6 +563,67 @@ bool Game::initSceneManager() {
     spdlog::trace("GAME::initSceneManager::场景管理器初始化成功");
     return true;
 }
+
+bool Game::initFrameProfiler() {
+    try {
+        m_frameProfiler = std::make_unique<debug::FrameProfiler>();
+    } catch (const std::exception &e) {
+        spdlog::error("GAME::initFrameProfiler::帧分析器初始化失败: {}", e.what());
+        return false;
+    }
+    return true;
+}
+
+bool Game::initFrameReport() {
+    try {
+        m_frameReport = std::make_unique<debug::FrameReport>();
+    } catch (const std::exception &e) {
+        spdlog::error("GAME::initFrameReport::帧时间报告初始化失败: {}", e.what());
+        return false;
+    }
+    // 帧时间超过目标帧时间 (不限帧时为固定步长) 的两倍记为一次卡顿，无头模式不限帧也不统计卡顿
+    if (!m_isHeadless) {
+        double frameTime = m_config->m_targetFPS > 0 ? 1.0 / m_config->m_targetFPS : m_time->getFixedDeltaTime();
+        m_frameReport->setStutterThreshold(frameTime * 2.0 * 1000.0);
+    }
+    return true;
+}
+
+bool Game::initImGui() {
+    if (m_isHeadless) {
+        spdlog::trace("GAME::initImGui::无头模式, 跳过 ImGui 初始化");
+        return true;
+    }
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImGui::GetIO().IniFilename = nullptr; // 不生成 imgui.ini
+    ImGui::StyleColorsDark();
+    if (!ImGui_ImplSDL3_InitForSDLRenderer(m_window, m_SDLRenderer) || !ImGui_ImplSDLRenderer3_Init(m_SDLRenderer)) {
+        spdlog::error("GAME::initImGui::ImGui 后端初始化失败");
+        ImGui::DestroyContext();
+        return false;
+    }
+    m_isImGuiInitialized = true;
+    spdlog::trace("GAME::initImGui::ImGui 初始化成功");
+    return true;
+}
+
+bool Game::initSimulationThread() {
+    m_isPipelined = m_config->m_pipelinedRender && !m_isHeadless;
+    if (!m_isPipelined) {
+        spdlog::trace("GAME::initSimulationThread::未启用流水线渲染, 模拟与渲染在主线程串行执行");
+        return true;
+    }
+    try {
+        m_simulationThread = std::thread(&Game::simulationLoop, this);
+    } catch (const std::exception &e) {
+        spdlog::error("GAME::initSimulationThread::模拟线程启动失败: {}", e.what());
+        m_isPipelined = false;
+        return false;
+    }
+    spdlog::trace("GAME::initSimulationThread::模拟线程启动成功, 渲染与模拟流水线执行");
+    return true;
+}
 /// @}
 
 void Game::onQuitEvent() {
@@ -273,4 +631,33 @@ void Game::onQuitEvent() {
     m_isRunning = false;
 }
 
+bool Game::onToggleProfiler() {
+    m_frameProfiler->toggleVisible();
+    spdlog::debug("GAME::onToggleProfiler::帧分析器叠加层: {}", m_frameProfiler->isVisible() ? "显示" : "隐藏");
+    return true;
+}
+
+bool Game::onDumpTrace() {
+#ifdef ENGINE_ENABLE_TRACE
+    debug::Trace::dump();
+#else
+    spdlog::warn("GAME::onDumpTrace::未启用追踪 (ENGINE_ENABLE_TRACE), 无法导出");
+#endif
+    return true;
+}
+
+bool Game::onDumpFrameReport() {
+    dumpFrameReport();
+    return true;
+}
+
+bool Game::onCycleGameSpeed() {
+    // 1x -> 2x -> 4x -> 最大 -> 1x
+    constexpr std::array<float, 4> speeds = {1.0f, 2.0f, 4.0f, 0.0f};
+    auto it = std::find(speeds.begin(), speeds.end(), m_gameState->getGameSpeed());
+    size_t next = it == speeds.end() ? 0 : (static_cast<size_t>(it - speeds.begin()) + 1) % speeds.size();
+    m_gameState->setGameSpeed(speeds[next]);
+    return true;
+}
+
 } // namespace engine::core
\ No newline at end of file
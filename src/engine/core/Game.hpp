@@ -1,10 +1,14 @@
 #pragma once
 #include <entt/signal/fwd.hpp>
+#include <condition_variable>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 struct SDL_Window;
 struct SDL_Renderer;
+struct SDL_Surface;
 
 namespace engine::resource {
 class ResourceManager;
@@ -20,10 +24,18 @@ class InputManager;
 namespace engine::scene {
 class SceneManager;
 }
+namespace engine::ecs {
+class PrototypeCache;
+}
+namespace engine::debug {
+class FrameProfiler;
+class FrameReport;
+}
 
 namespace engine::core {
 
 class Time; // 前向声明
+class JobSystem;
 class Config;
 class Context;
 class GameState;
@@ -41,6 +53,19 @@ class Game final {
     SDL_Renderer *m_SDLRenderer = nullptr; /**< 指向SDL渲染器的指针 */
     bool          m_isRunning   = false;   /**< 标记游戏是否正在运行 */
 
+    bool         m_isHeadless         = false;   /**< 无头模式: 不创建窗口、不渲染、不限帧 */
+    int          m_maxFrames          = 0;       /**< 无头模式下运行的最大帧数，0 表示不限制 */
+    SDL_Surface *m_headlessSurface    = nullptr; /**< 无头模式下软件渲染器的离屏目标 */
+    bool         m_isImGuiInitialized = false;   /**< ImGui 是否已初始化 (无头模式下不初始化) */
+
+    bool                    m_isPipelined         = false; /**< 流水线模式: 模拟线程更新并录制本帧命令，主线程同时提交上一帧命令 */
+    std::thread             m_simulationThread;            /**< 流水线模式下的模拟线程 */
+    std::mutex              m_simulationMutex;             /**< 保护以下三个握手标志 */
+    std::condition_variable m_simulationCondition;         /**< 主线程与模拟线程之间的握手 */
+    bool                    m_simulationRequested = false; /**< 主线程已请求模拟一帧 */
+    bool                    m_simulationFinished  = true;  /**< 模拟线程已完成本帧 */
+    bool                    m_simulationExit      = false; /**< 通知模拟线程退出 */
+
     /// @brief 游戏场景设置函数，用于在运行游戏前设置初始场景 (GameApp不再决定初始场景是什么)
     std::function<void(engine::core::Context &)> m_sceneSetupFunc;
 
@@ -55,6 +80,10 @@ class Game final {
     std::unique_ptr<Context>                   m_context         = nullptr; /**< 指向游戏上下文的智能指针 */
     std::unique_ptr<scene::SceneManager>       m_sceneManager    = nullptr; /**< 指向场景管理器的智能指针 */
     std::unique_ptr<engine::core::GameState>   m_gameState       = nullptr; /**< 指向游戏状态的智能指针 */
+    std::unique_ptr<debug::FrameProfiler>      m_frameProfiler   = nullptr; /**< 指向帧分析器的智能指针 */
+    std::unique_ptr<debug::FrameReport>        m_frameReport     = nullptr; /**< 指向帧时间报告的智能指针 */
+    std::unique_ptr<JobSystem>                 m_jobSystem       = nullptr; /**< 指向线程池的智能指针 */
+    std::unique_ptr<ecs::PrototypeCache>       m_prototypeCache  = nullptr; /**< 指向实体原型缓存的智能指针 */
 
   public:
     Game();
@@ -67,6 +96,13 @@ class Game final {
      * @param func 一个接收 SceneManager 引用的函数对象。
      */
     void registerSceneSetup(std::function<void(engine::core::Context &)> func);
+    /**
+     * @brief 设置无头模式 (必须在 run() 之前调用)
+     * @param headless 是否启用无头模式。启用后不创建窗口，使用离屏软件渲染器，不限帧也不渲染，
+     *                 每次循环推进一个固定步长，模拟速度只受 CPU 限制
+     * @param maxFrames 运行的最大帧数，达到后自动退出，0 表示不限制
+     */
+    void setHeadless(bool headless, int maxFrames = 0);
 
     Game(const Game &)            = delete; /**< 删除拷贝构造函数 */
     Game &operator=(const Game &) = delete; /**< 删除拷贝赋值运算符 */
@@ -74,27 +110,49 @@ class Game final {
     Game &operator=(Game &&)      = delete; /**< 删除移动赋值运算符 */
 
   private:
-    [[nodiscard]] bool init();                  /// @brief 初始化SDL窗口和渲染器
+    [[nodiscard]] bool init();                 /// @brief 初始化SDL窗口和渲染器
     void               handleEvents();          /// @brief 处理SDL事件
     void               update(float deltaTime); /// @brief 更新游戏状态
-    void               render();                /// @brief 渲染游戏画面
+    void               simulate();              /// @brief 处理场景输入、执行本帧所有模拟步并录制绘制命令
+    void               recordCommands();        /// @brief 录制本帧的绘制命令 (不调用 SDL)
+    void               render();                /// @brief 清屏并提交命令列表 (主线程)
+    void               present();               /// @brief 绘制调试叠加层并呈现画面 (主线程)
+    void               runHeadless();           /// @brief 无头模式主循环
+    void               renderDebugOverlay();    /// @brief 渲染 ImGui 调试叠加层
+    void               simulationLoop();        /// @brief 模拟线程主循环
+    void               startSimulation();       /// @brief 唤醒模拟线程执行一帧
+    void               waitForSimulation();     /// @brief 等待模拟线程完成本帧
+    void               stopSimulationThread();  /// @brief 通知模拟线程退出并等待其结束
+    void               applyGameSpeed();        /// @brief 把 GameState 中的游戏速度同步到 Time (每帧开始时调用)
+    void               dumpFrameReport();       /// @brief 收集场景与对象数量信息并导出帧时间报告
     void               close();                 /// @brief 关闭SDL窗口和渲染器，释放资源
 
-    [[nodiscard]] bool initDispatcher();      /// @brief 初始化事件调度器
-    [[nodiscard]] bool initConfig();          /// @brief 初始化配置类
-    [[nodiscard]] bool initWindow();          /// @brief 初始化SDL窗口
-    [[nodiscard]] bool initTime();            /// @brief 初始化时间管理组件
-    [[nodiscard]] bool initResourceManager(); /// @brief 初始化资源管理组件
-    [[nodiscard]] bool initRenderer();        /// @brief 初始化渲染器组件
-    [[nodiscard]] bool initCamera();          /// @brief 初始化相机组件
-    [[nodiscard]] bool initTextRenderer();    /// @brief 初始化文本渲染器
-    [[nodiscard]] bool initInputManager();    /// @brief 初始化输入管理组件
-    [[nodiscard]] bool initGameState();       /// @brief 初始化游戏状态
-    [[nodiscard]] bool initContext();         /// @brief 初始化游戏上下文
-    [[nodiscard]] bool initSceneManager();    /// @brief 初始化场景管理器
+    [[nodiscard]] bool initDispatcher();       /// @brief 初始化事件调度器
+    [[nodiscard]] bool initConfig();           /// @brief 初始化配置类
+    [[nodiscard]] bool initWindow();           /// @brief 初始化SDL窗口
+    [[nodiscard]] bool initHeadlessRenderer(); /// @brief 无头模式下初始化离屏渲染器
+    [[nodiscard]] bool initTime();             /// @brief 初始化时间管理组件
+    [[nodiscard]] bool initResourceManager();  /// @brief 初始化资源管理组件
+    [[nodiscard]] bool initRenderer();         /// @brief 初始化渲染器组件
+    [[nodiscard]] bool initCamera();           /// @brief 初始化相机组件
+    [[nodiscard]] bool initTextRenderer();     /// @brief 初始化文本渲染器
+    [[nodiscard]] bool initInputManager();     /// @brief 初始化输入管理组件
+    [[nodiscard]] bool initGameState();        /// @brief 初始化游戏状态
+    [[nodiscard]] bool initJobSystem();        /// @brief 初始化线程池
+    [[nodiscard]] bool initPrototypeCache();   /// @brief 初始化实体原型缓存
+    [[nodiscard]] bool initContext();          /// @brief 初始化游戏上下文
+    [[nodiscard]] bool initSceneManager();     /// @brief 初始化场景管理器
+    [[nodiscard]] bool initFrameProfiler();    /// @brief 初始化帧分析器
+    [[nodiscard]] bool initFrameReport();      /// @brief 初始化帧时间报告
+    [[nodiscard]] bool initImGui();            /// @brief 初始化 ImGui
+    [[nodiscard]] bool initSimulationThread(); /// @brief 按配置启动模拟线程 (流水线模式)
 
     // 事件处理函数
     void onQuitEvent();
+    bool onToggleProfiler();
+    bool onDumpTrace();
+    bool onCycleGameSpeed();
+    bool onDumpFrameReport();
 };
 
 } // namespace engine::core
@@ -1,15 +1,21 @@
 #include "GameState.hpp"
+#include <SDL3/SDL_init.h>
 #include <spdlog/spdlog.h>
 #include <stdexcept>
+#include <utility>
 
 namespace engine::core {
 
 GameState::GameState(SDL_Window *window, SDL_Renderer *renderer, State initialState)
     : m_window(window), m_renderer(renderer), m_currentState(initialState) {
-    if (m_window == nullptr || m_renderer == nullptr) {
-        spdlog::error("GAMESTATE::窗口或渲染器为空");
-        throw std::runtime_error("GAMESTATE::窗口或渲染器不能为空");
+    if (m_renderer == nullptr) {
+        spdlog::error("GAMESTATE::渲染器为空");
+        throw std::runtime_error("GAMESTATE::渲染器不能为空");
     }
+    if (m_window == nullptr) {
+        spdlog::info("GAMESTATE::窗口为空, 以无头模式运行");
+    }
+    syncWithSDL();
     spdlog::trace("GAMESTATE::游戏状态初始化完成");
 }
 
@@ -22,27 +28,59 @@ void GameState::setState(State newState) {
     }
 }
 
-glm::vec2 GameState::getWindowSize() const {
-    int width, height;
-    // SDL3获取窗口大小的方法
-    SDL_GetWindowSize(m_window, &width, &height);
-    return glm::vec2(width, height);
+void GameState::setGameSpeed(float speed) {
+    if (speed < 0.0f) {
+        spdlog::warn("GAMESTATE::setGameSpeed::游戏速度不能为负数 ({}), 设置为 1", speed);
+        speed = 1.0f;
+    }
+    m_gameSpeed = speed;
+    spdlog::debug("GAMESTATE::setGameSpeed::游戏速度设置为: {}", isMaxGameSpeed() ? "最大" : std::to_string(speed) + "x");
 }
 
 void GameState::setWindowSize(const glm::vec2 &m_windowsize) {
+    if (!m_window) return;
+    if (!SDL_IsMainThread()) {
+        std::lock_guard lock(m_pendingMutex);
+        m_pendingWindowSize = m_windowsize;
+        return;
+    }
     SDL_SetWindowSize(m_window, static_cast<int>(m_windowsize.x), static_cast<int>(m_windowsize.y));
-}
-
-glm::vec2 GameState::getLogicalSize() const {
-    int width, height;
-    // SDL3获取逻辑分辨率的方法
-    SDL_GetRenderLogicalPresentation(m_renderer, &width, &height, NULL);
-    return glm::vec2(width, height);
+    syncWithSDL();
 }
 
 void GameState::setLogicalSize(const glm::vec2 &logicalSize) {
+    if (!SDL_IsMainThread()) {
+        std::lock_guard lock(m_pendingMutex);
+        m_pendingLogicalSize = logicalSize;
+        return;
+    }
     SDL_SetRenderLogicalPresentation(m_renderer, static_cast<int>(logicalSize.x), static_cast<int>(logicalSize.y), SDL_LOGICAL_PRESENTATION_LETTERBOX);
     spdlog::trace("GAMESTATE::setLogicalSize::逻辑分辨率设置为: {}x{}", logicalSize.x, logicalSize.y);
+    syncWithSDL();
+}
+
+void GameState::syncWithSDL() {
+    std::optional<glm::vec2> windowSize;
+    std::optional<glm::vec2> logicalSize;
+    {
+        std::lock_guard lock(m_pendingMutex);
+        windowSize = std::exchange(m_pendingWindowSize, std::nullopt);
+        logicalSize = std::exchange(m_pendingLogicalSize, std::nullopt);
+    }
+    if (windowSize) setWindowSize(*windowSize);
+    if (logicalSize) setLogicalSize(*logicalSize);
+
+    int width, height;
+    // SDL3获取逻辑分辨率的方法
+    SDL_GetRenderLogicalPresentation(m_renderer, &width, &height, NULL);
+    m_logicalSize = glm::vec2(width, height);
+    if (m_window) {
+        // SDL3获取窗口大小的方法
+        SDL_GetWindowSize(m_window, &width, &height);
+        m_windowSize = glm::vec2(width, height);
+    } else {
+        m_windowSize = m_logicalSize.load(); // 无头模式没有窗口，以逻辑分辨率代替
+    }
 }
 
 } // namespace engine::core
\ No newline at end of file
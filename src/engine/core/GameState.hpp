@@ -2,6 +2,8 @@
 #include <SDL3/SDL_render.h>
 #include <SDL3/SDL_video.h>
 #include <glm/vec2.hpp>
+#include <atomic>
+#include <mutex>
 #include <optional>
 #include <string>
 
@@ -24,28 +26,47 @@ enum class State {
  *
  * 提供一个中心点来确定游戏当前处于哪个主要模式，
  * 以便其他系统（输入、渲染、更新等）可以相应地调整其行为。
+ *
+ * 窗口大小与逻辑分辨率只能在主线程通过 SDL 读写。流水线渲染时场景在模拟线程中更新，
+ * 因此 getter 返回主线程每帧 (syncWithSDL) 刷新的缓存，在其他线程调用 setter 时推迟到下一次同步执行。
  */
 class GameState final {
   private:
-    SDL_Window *m_window = nullptr;      ///< @brief SDL窗口，用于获取窗口大小
+    SDL_Window *m_window = nullptr;      ///< @brief SDL窗口，用于获取窗口大小（无头模式下为空）
     SDL_Renderer *m_renderer = nullptr;  ///< @brief SDL渲染器，用于获取逻辑分辨率
     State m_currentState = State::Title; ///< @brief 当前游戏状态
+    float m_gameSpeed = 1.0f;            ///< @brief 游戏速度倍率，0 表示最大速度 (每帧在预算内执行尽可能多的模拟步)
+
+    std::atomic<glm::vec2> m_windowSize = glm::vec2(0.0f);   ///< @brief 窗口大小缓存 (主线程刷新，任意线程读取)
+    std::atomic<glm::vec2> m_logicalSize = glm::vec2(0.0f);  ///< @brief 逻辑分辨率缓存
+    std::mutex m_pendingMutex;                               ///< @brief 保护待执行的尺寸修改
+    std::optional<glm::vec2> m_pendingWindowSize;            ///< @brief 非主线程请求的窗口大小，下一次 syncWithSDL 时设置
+    std::optional<glm::vec2> m_pendingLogicalSize;           ///< @brief 非主线程请求的逻辑分辨率
 
   public:
     /**
      * @brief 构造函数，初始化游戏状态。
-     * @param window SDL窗口，必须传入有效值。
+     * @param window SDL窗口，无头模式下可以为空。
      * @param renderer SDL渲染器，必须传入有效值。
      * @param initialState 游戏的初始状态，默认为 Title
      */
     explicit GameState(SDL_Window *window, SDL_Renderer *renderer, State initialState = State::Title);
 
     State getCurrentState() const { return m_currentState; }
-    glm::vec2 getLogicalSize() const;
-    glm::vec2 getWindowSize() const;
+    glm::vec2 getLogicalSize() const { return m_logicalSize.load(); } ///< @brief 获取逻辑分辨率 (缓存，任意线程可调用)
+    glm::vec2 getWindowSize() const { return m_windowSize.load(); }   ///< @brief 获取窗口大小 (缓存，无头模式下为逻辑分辨率)
     void setState(State newState);
     void setWindowSize(const glm::vec2 &m_windowsize); // 这里并不涉及到(成员变量)赋值，所以不需要move
     void setLogicalSize(const glm::vec2 &logicalSize);
+    /// @brief 执行其他线程请求的尺寸修改并刷新尺寸缓存 (只能在主线程调用，Game 每帧轮询事件后调用)
+    void syncWithSDL();
+    /**
+     * @brief 设置游戏速度倍率 (由 Game 在每帧开始时同步到 Time)
+     * @param speed 速度倍率 (如 1、2、4)，0 表示最大速度；负数视为 1
+     */
+    void setGameSpeed(float speed);
+    float getGameSpeed() const { return m_gameSpeed; }
+    bool isMaxGameSpeed() const { return m_gameSpeed == 0.0f; }
 
     // --- 便捷查询方法 ---
     bool isInTitle() const { return m_currentState == State::Title; }
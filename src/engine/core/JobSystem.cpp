@@ -0,0 +1,133 @@
+#include "JobSystem.hpp"
+#include "../debug/Trace.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <string>
+
+namespace engine::core {
+
+namespace {
+thread_local size_t t_queueIndex = 0; // 当前线程的队列索引，非工作线程为 0 (共享队列)
+} // namespace
+
+JobSystem::JobSystem(int workerCount) {
+    if (workerCount <= 0) {
+        auto hardwareThreads = static_cast<int>(std::thread::hardware_concurrency());
+        workerCount = std::max(hardwareThreads - 1, 0);
+    }
+    m_queues.reserve(workerCount + 1);
+    for (int i = 0; i <= workerCount; ++i) {
+        m_queues.push_back(std::make_unique<WorkQueue>());
+    }
+    m_workers.reserve(workerCount);
+    for (int i = 0; i < workerCount; ++i) {
+        m_workers.emplace_back(&JobSystem::workerLoop, this, static_cast<size_t>(i + 1));
+    }
+    spdlog::trace("JOBSYSTEM::线程池初始化成功, 工作线程数: {}", workerCount);
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard lock(m_wakeMutex);
+        m_isRunning = false;
+    }
+    m_wakeCondition.notify_all();
+    for (auto &worker : m_workers) {
+        if (worker.joinable()) worker.join();
+    }
+    spdlog::trace("JOBSYSTEM::线程池已关闭");
+}
+
+void JobSystem::submit(Job job) {
+    {
+        // 在唤醒锁内增加计数，避免工作线程检查完条件、尚未进入等待时错过通知
+        // (先计数再入队，保证计数不会因任务被提前取走而下溢)
+        std::lock_guard lock(m_wakeMutex);
+        m_pendingJobs.fetch_add(1, std::memory_order_release);
+    }
+    auto &queue = *m_queues[currentQueueIndex()];
+    {
+        std::lock_guard lock(queue.mutex);
+        queue.jobs.push_back(std::move(job));
+    }
+    m_wakeCondition.notify_one();
+}
+
+void JobSystem::parallelFor(size_t count, size_t chunkSize, const RangeJob &func) {
+    if (count == 0) return;
+    chunkSize = std::max<size_t>(chunkSize, 1);
+    // 没有工作线程或只有一段时，直接在当前线程执行
+    if (m_workers.empty() || count <= chunkSize) {
+        func(0, count);
+        return;
+    }
+
+    ENGINE_TRACE_ZONE("JobSystem::parallelFor");
+    size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+    std::atomic<size_t> remaining = chunkCount;
+    // 第一段留给当前线程，其余段作为任务提交
+    for (size_t chunk = 1; chunk < chunkCount; ++chunk) {
+        size_t begin = chunk * chunkSize;
+        size_t end = std::min(begin + chunkSize, count);
+        submit([&func, &remaining, begin, end] {
+            func(begin, end);
+            remaining.fetch_sub(1, std::memory_order_release);
+        });
+    }
+    func(0, std::min(chunkSize, count));
+    remaining.fetch_sub(1, std::memory_order_release);
+
+    // 等待期间帮忙执行任务 (可能是本次的，也可能是其他任务)
+    size_t queueIndex = currentQueueIndex();
+    while (remaining.load(std::memory_order_acquire) > 0) {
+        if (!tryRunOne(queueIndex)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::workerLoop(size_t queueIndex) {
+    t_queueIndex = queueIndex;
+    debug::Trace::setThreadName("Worker " + std::to_string(queueIndex));
+    while (m_isRunning.load(std::memory_order_acquire)) {
+        if (tryRunOne(queueIndex)) continue;
+        std::unique_lock lock(m_wakeMutex);
+        m_wakeCondition.wait(lock, [this] {
+            return !m_isRunning.load(std::memory_order_acquire) || m_pendingJobs.load(std::memory_order_acquire) > 0;
+        });
+    }
+}
+
+bool JobSystem::tryRunOne(size_t queueIndex) {
+    Job job;
+    // 1. 先从自己队列的尾部取
+    {
+        auto &queue = *m_queues[queueIndex];
+        std::lock_guard lock(queue.mutex);
+        if (!queue.jobs.empty()) {
+            job = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+        }
+    }
+    // 2. 再依次从其他队列的头部窃取
+    for (size_t offset = 1; !job && offset < m_queues.size(); ++offset) {
+        auto &victim = *m_queues[(queueIndex + offset) % m_queues.size()];
+        std::lock_guard lock(victim.mutex);
+        if (!victim.jobs.empty()) {
+            job = std::move(victim.jobs.front());
+            victim.jobs.pop_front();
+        }
+    }
+    if (!job) return false;
+    m_pendingJobs.fetch_sub(1, std::memory_order_acq_rel);
+    job();
+    return true;
+}
+
+size_t JobSystem::currentQueueIndex() const {
+    return t_queueIndex;
+}
+
+} // namespace engine::core
@@ -0,0 +1,75 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace engine::core {
+
+/**
+ * @brief 工作窃取线程池
+ *
+ * 每个工作线程拥有自己的任务队列：从自己队列的尾部取任务 (LIFO，缓存友好)，
+ * 自己的队列为空时从其他队列的头部窃取任务 (FIFO)。非工作线程 (如主线程) 提交的任务放入共享队列。
+ * parallelFor 会阻塞调用线程，但调用线程在等待期间同样会执行队列中的任务，不会空等。
+ *
+ * @note 任务中不应抛出异常 (游戏主循环中不使用异常)
+ */
+class JobSystem final {
+  public:
+    using Job = std::function<void()>;
+    using RangeJob = std::function<void(size_t begin, size_t end)>;
+
+  private:
+    /// @brief 单个任务队列
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    std::vector<std::thread> m_workers;               ///< @brief 工作线程
+    std::vector<std::unique_ptr<WorkQueue>> m_queues; ///< @brief 任务队列，0 号为非工作线程共享，i + 1 号属于第 i 个工作线程
+    std::atomic<bool> m_isRunning = true;             ///< @brief 线程池是否在运行
+    std::atomic<size_t> m_pendingJobs = 0;            ///< @brief 已提交但尚未被取走的任务数
+    std::mutex m_wakeMutex;                           ///< @brief 与 m_wakeCondition 配合使用
+    std::condition_variable m_wakeCondition;          ///< @brief 有新任务时唤醒空闲的工作线程
+
+  public:
+    /**
+     * @brief 构造函数，创建工作线程
+     * @param workerCount 工作线程数量，0 表示自动 (硬件线程数 - 1，主线程也会参与执行任务)
+     */
+    explicit JobSystem(int workerCount = 0);
+    ~JobSystem();
+
+    JobSystem(const JobSystem &) = delete;
+    JobSystem &operator=(const JobSystem &) = delete;
+    JobSystem(JobSystem &&) = delete;
+    JobSystem &operator=(JobSystem &&) = delete;
+
+    /// @brief 提交一个异步任务 (不等待完成)
+    void submit(Job job);
+
+    /**
+     * @brief 把 [0, count) 分成大小为 chunkSize 的若干段并行执行，所有段完成后才返回
+     * @param count 元素总数
+     * @param chunkSize 每段的元素数 (过小会增加调度开销)
+     * @param func 处理一段 [begin, end) 的函数，不同段之间不能写同一份数据
+     */
+    void parallelFor(size_t count, size_t chunkSize, const RangeJob &func);
+
+    /// @brief 获取工作线程数量 (不含调用线程)
+    size_t getWorkerCount() const { return m_workers.size(); }
+
+  private:
+    void workerLoop(size_t queueIndex); ///< @brief 工作线程主循环
+    bool tryRunOne(size_t queueIndex);  ///< @brief 从自己的队列取出或从其他队列窃取一个任务并执行
+    size_t currentQueueIndex() const;   ///< @brief 当前线程对应的队列索引
+};
+
+} // namespace engine::core
@@ -1,10 +1,22 @@
 #include "Time.hpp"
+#include "../debug/Trace.hpp"
 
 #include <SDL3/SDL_Timer.h>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <thread>
+
 namespace engine::core {
 
+namespace {
+constexpr Uint64 MIN_SPIN_WINDOW_NS = 250000;  // 自旋窗口下限 0.25ms
+constexpr Uint64 MAX_SPIN_WINDOW_NS = 4000000; // 自旋窗口上限 4ms
+constexpr double OVERSLEEP_SMOOTHING = 0.1;    // 超时估计的指数平滑系数
+constexpr double SPIN_WINDOW_MARGIN = 1.5;     // 自旋窗口 = 超时估计 * 余量
+constexpr double MAX_SPEED_BUDGET_RATIO = 0.75; // 最大速度模式下模拟可占用的帧时间比例 (其余留给渲染)
+} // namespace
+
 Time::Time() {
     m_endTime = SDL_GetTicksNS();
     m_startTime = m_endTime;
@@ -14,8 +26,7 @@ Time::Time() {
 Time::Time(int fps) {
     m_endTime = SDL_GetTicksNS();
     m_startTime = m_endTime;
-    m_targrtFPS = fps;
-    m_targetFrameTime = 1.0f / fps;
+    setTargetFPS(fps);
     m_timeScale = 1.0;
 }
 
@@ -26,21 +37,117 @@ Time::~Time() {
 void Time::update() {
     m_startTime = SDL_GetTicksNS();
     auto currentDeltaTime = static_cast<double>(m_startTime - m_endTime) / 1000000000.0; // 计算当前帧时间
-    if (currentDeltaTime > 0.0) {
-        limitFrameRate(static_cast<float>(currentDeltaTime)); // 如果设置了帧率限制，则限制帧率
-    } else {
-        m_deltaTime = currentDeltaTime; // 如果当前帧时间小于0，则直接使用当前帧时间
+    m_limiterWaitTime = 0.0;
+    if (m_targetFrameTime > 0.0) {
+        limitFrameRate(currentDeltaTime); // 如果设置了帧率限制，则限制帧率
+    }
+    // 帧间隔 = 本帧开始 (等待之后) 到上一帧开始的时间，无论是否发生等待都要更新
+    Uint64 now = SDL_GetTicksNS();
+    m_deltaTime = static_cast<double>(now - m_endTime) / 1000000000.0;
+    m_endTime = now; // 更新结束时间
+    m_pacingError = m_targetFrameTime > 0.0 ? m_deltaTime - m_targetFrameTime : 0.0;
+    m_stepsThisFrame = 0;
+
+    if (m_fixedTimestepEnabled && !m_maxSpeed) {
+        m_accumulator += getDeltaTime();
+        // 一帧卡顿过久时只追赶 m_maxFixedSteps 步 (按游戏速度放大)，多余的时间直接丢弃 (模拟变慢，但不会越追越卡)
+        double maxAccumulated = m_fixedDeltaTime * m_maxFixedSteps * std::max(m_timeScale, 1.0);
+        if (m_accumulator > maxAccumulated) {
+            spdlog::debug("TIME::update::帧时间过长 ({:.2f} ms), 丢弃 {:.2f} ms 模拟时间", m_deltaTime * 1000.0, (m_accumulator - maxAccumulated) * 1000.0);
+            m_accumulator = maxAccumulated;
+        }
+    }
+}
+
+bool Time::consumeFixedStep() {
+    if (m_maxSpeed) {
+        // 至少推进一步，保证帧预算再紧也不会停止模拟
+        if (m_stepsThisFrame > 0 && !hasFrameBudget()) return false;
+        ++m_stepsThisFrame;
+        return true;
+    }
+    if (!m_fixedTimestepEnabled || m_accumulator < m_fixedDeltaTime) return false;
+    m_accumulator -= m_fixedDeltaTime;
+    ++m_stepsThisFrame;
+    return true;
+}
+
+bool Time::hasFrameBudget() const {
+    // 不限帧时以一个固定步长作为预算，避免最大速度模式完全阻塞渲染
+    double frameTime = m_targetFrameTime > 0.0 ? m_targetFrameTime : m_fixedDeltaTime;
+    auto budgetNS = static_cast<Uint64>(frameTime * MAX_SPEED_BUDGET_RATIO * 1000000000.0);
+    return SDL_GetTicksNS() - m_endTime < budgetNS;
+}
+
+/// @name setter
+/// @{
+void Time::setTargetFPS(int fps) {
+    m_targrtFPS = fps;
+    m_targetFrameTime = fps > 0 ? 1.0 / fps : 0.0; // 0 表示不限制帧率
+}
+
+void Time::setFixedTimestepEnabled(bool enabled) {
+    m_fixedTimestepEnabled = enabled;
+    m_accumulator = 0.0;
+}
+
+void Time::setFixedUpdateFPS(int fps) {
+    if (fps <= 0) {
+        spdlog::warn("TIME::setFixedUpdateFPS::固定步长频率必须大于 0, 当前值 {} 无效, 保持 {}", fps, m_fixedUpdateFPS);
+        return;
     }
-    m_endTime = SDL_GetTicksNS(); // 更新结束时间
+    m_fixedUpdateFPS = fps;
+    m_fixedDeltaTime = 1.0 / fps;
+}
+
+void Time::setMaxFixedSteps(int steps) {
+    m_maxFixedSteps = std::max(steps, 1);
+}
+
+void Time::setMaxSpeed(bool enabled) {
+    if (m_maxSpeed == enabled) return;
+    m_maxSpeed = enabled;
+    m_accumulator = 0.0;
+}
+/// @}
+
+double Time::getInterpolationAlpha() const {
+    if (!m_fixedTimestepEnabled || m_maxSpeed) return 1.0;
+    return std::clamp(m_accumulator / m_fixedDeltaTime, 0.0, 1.0);
 }
 
-void Time::limitFrameRate(float currentDeltaTime) {
+void Time::limitFrameRate(double currentDeltaTime) {
+    ENGINE_TRACE_ZONE("Time::limitFrameRate");
     if (currentDeltaTime < m_targetFrameTime) {
         double timeToWait = m_targetFrameTime - currentDeltaTime;
         Uint64 nsToWait = static_cast<Uint64>(timeToWait * 1000000000.0);
-        SDL_DelayNS(nsToWait);
-        m_deltaTime = static_cast<double>(SDL_GetTicksNS() - m_startTime) / 1000000000.0;
+        if (m_precisePacing) {
+            waitUntilPrecise(m_startTime + nsToWait);
+        } else {
+            SDL_DelayNS(nsToWait);
+        }
+        m_limiterWaitTime = static_cast<double>(SDL_GetTicksNS() - m_startTime) / 1000000000.0;
+    }
+}
+
+void Time::waitUntilPrecise(Uint64 deadlineNS) {
+    Uint64 now = SDL_GetTicksNS();
+    // 1. 粗略休眠: 只休眠到距离目标还剩一个自旋窗口的时刻，系统调度的误差由后面的自旋吸收
+    if (deadlineNS > now + m_spinWindowNS) {
+        Uint64 sleepNS = deadlineNS - now - m_spinWindowNS;
+        SDL_DelayNS(sleepNS);
+        Uint64 afterSleep = SDL_GetTicksNS();
+        // 记录实际多睡了多少，平滑后用于调整自旋窗口
+        double oversleep = static_cast<double>(afterSleep - now) - static_cast<double>(sleepNS);
+        m_oversleepEstimateNS += (std::max(oversleep, 0.0) - m_oversleepEstimateNS) * OVERSLEEP_SMOOTHING;
+        m_spinWindowNS = std::clamp(static_cast<Uint64>(m_oversleepEstimateNS * SPIN_WINDOW_MARGIN), MIN_SPIN_WINDOW_NS, MAX_SPIN_WINDOW_NS);
+        now = afterSleep;
+    }
+    // 2. 自旋等待: 让出时间片而不是空转，避免占满整个核心
+    while (now < deadlineNS) {
+        std::this_thread::yield();
+        now = SDL_GetTicksNS();
     }
 }
 
-} // namespace engine::core
\ No newline at end of file
+} // namespace engine::core
@@ -5,6 +5,10 @@ namespace engine::core {
 /**
  * @brief 时间管理类
  * @brief 提供时间管理功能，包括时间间隔、时间缩放、帧率控制等
+ * @brief 精确限帧模式下先粗略休眠，再以自旋等待补足最后一段时间，自旋窗口根据实测的休眠超时自动调整
+ * @brief 开启固定步长后，每帧的时间会累积到累加器中，由 consumeFixedStep() 按固定步长逐步消耗
+ * @brief 时间缩放 (游戏速度) 作用于累加器，单帧可追赶的步数随倍率同比放大；最大速度模式下不再累积时间，
+ *        而是在帧预算内执行尽可能多的固定步
  */
 class Time final {
   private:
@@ -16,6 +20,21 @@ class Time final {
     int m_targrtFPS = 60;           ///< @brief 目标帧率
     double m_targetFrameTime = 0.0; ///< @brief 帧时间
 
+    bool m_precisePacing = false;       ///< @brief 是否启用精确限帧 (休眠 + 自旋)
+    Uint64 m_spinWindowNS = 2000000;    ///< @brief 自旋等待窗口（纳秒），会根据实测超时自适应
+    double m_oversleepEstimateNS = 0.0; ///< @brief 休眠超时的平滑估计值（纳秒）
+    double m_pacingError = 0.0;         ///< @brief 本帧实际帧时间与目标帧时间的差值（秒），正数表示超时
+    double m_limiterWaitTime = 0.0;     ///< @brief 本帧限帧器等待的总时间（秒）
+
+    bool m_fixedTimestepEnabled = false;  ///< @brief 是否启用固定步长
+    int m_fixedUpdateFPS = 60;            ///< @brief 固定步长更新频率
+    double m_fixedDeltaTime = 1.0 / 60.0; ///< @brief 固定步长（秒）
+    int m_maxFixedSteps = 5;              ///< @brief 每帧最多执行的固定步数，超出部分直接丢弃，防止"死亡螺旋"
+    double m_accumulator = 0.0;           ///< @brief 尚未被模拟消耗的时间（秒）
+
+    bool m_maxSpeed = false;  ///< @brief 最大速度模式: 每帧在预算内执行尽可能多的固定步
+    int m_stepsThisFrame = 0; ///< @brief 本帧已执行的固定步数
+
   public:
     Time();
     Time(int fps);
@@ -29,23 +48,54 @@ class Time final {
     /// @brief 更新时间
     void update();
 
-    void setTargetFPS(int fps) {
-        m_targrtFPS = fps;
-        m_targetFrameTime = 1.0f / fps;
-    }
+    /**
+     * @brief 消耗一个固定步长
+     * @return 累加器中剩余时间足够一个步长时返回 true，调用方应执行一次模拟更新；
+     *         最大速度模式下第一步总是返回 true，之后只要本帧预算未用完就返回 true
+     */
+    bool consumeFixedStep();
+
+    void setTargetFPS(int fps);
     void setTimeScale(double scale) { m_timeScale = scale; }
+    void setPrecisePacing(bool enabled) { m_precisePacing = enabled; }
+    void setFixedTimestepEnabled(bool enabled);
+    void setFixedUpdateFPS(int fps);
+    void setMaxFixedSteps(int steps);
+    /// @brief 设置最大速度模式 (切换时清空累加器)
+    void setMaxSpeed(bool enabled);
 
     double getDeltaTime() const { return m_deltaTime * m_timeScale; }
     double getUnscaledDeltaTime() const { return m_deltaTime; }
     double getTimeScale() const { return m_timeScale; }
     double getFrameTime() const { return m_targetFrameTime; }
+    bool isPrecisePacing() const { return m_precisePacing; }
+    double getPacingError() const { return m_pacingError; }
+    double getLimiterWaitTime() const { return m_limiterWaitTime; }
+    double getSpinWindow() const { return static_cast<double>(m_spinWindowNS) / 1000000000.0; }
+    bool isFixedTimestepEnabled() const { return m_fixedTimestepEnabled; }
+    double getFixedDeltaTime() const { return m_fixedDeltaTime; }
+    int getMaxFixedSteps() const { return m_maxFixedSteps; }
+    bool isMaxSpeed() const { return m_maxSpeed; }
+    int getStepsThisFrame() const { return m_stepsThisFrame; }
+    /**
+     * @brief 获取渲染插值系数
+     * @return [0, 1]，表示当前时刻位于上一个与下一个模拟状态之间的比例；未启用固定步长或最大速度模式下恒为 1
+     */
+    double getInterpolationAlpha() const;
+    /// @brief 本帧 (从 update() 结束算起) 的模拟预算是否还有剩余，用于最大速度模式
+    bool hasFrameBudget() const;
 
   private:
     /**
      * @brief 限制帧率
      * @param currentDeltaTime 当前时间间隔
      */
-    void limitFrameRate(float currentDeltaTime);
+    void limitFrameRate(double currentDeltaTime);
+    /**
+     * @brief 精确等待到指定时刻
+     * @param deadlineNS 目标时刻 (SDL_GetTicksNS 时间轴)
+     */
+    void waitUntilPrecise(Uint64 deadlineNS);
 };
 
-} // namespace engine::core
\ No newline at end of file
+} // namespace engine::core
@@ -0,0 +1,146 @@
+#include "FrameProfiler.hpp"
+
+#include <SDL3/SDL_timer.h>
+#include <imgui.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace engine::debug {
+
+FrameProfiler::FrameProfiler() {
+    m_ticksToMS = 1000.0 / static_cast<double>(SDL_GetPerformanceFrequency());
+    spdlog::trace("FRAMEPROFILER::帧分析器初始化成功, 历史帧数: {}", HISTORY_SIZE);
+}
+
+/// @name 计时
+/// @{
+void FrameProfiler::beginFrame() {
+    m_phaseTicks.fill(0);
+    m_frameStart = SDL_GetPerformanceCounter();
+}
+
+void FrameProfiler::endFrame() {
+    Uint64 now = SDL_GetPerformanceCounter();
+    for (size_t i = 0; i < PHASE_COUNT; ++i) {
+        m_phaseHistory[i][m_writeIndex] = static_cast<float>(m_phaseTicks[i] * m_ticksToMS);
+    }
+    m_frameHistory[m_writeIndex] = static_cast<float>((now - m_frameStart) * m_ticksToMS);
+    m_writeIndex = (m_writeIndex + 1) % HISTORY_SIZE;
+    m_sampleCount = std::min(m_sampleCount + 1, HISTORY_SIZE);
+}
+
+void FrameProfiler::beginPhase(ProfilePhase phase) {
+    m_phaseStart[static_cast<size_t>(phase)] = SDL_GetPerformanceCounter();
+}
+
+void FrameProfiler::endPhase(ProfilePhase phase) {
+    auto index = static_cast<size_t>(phase);
+    m_phaseTicks[index] += SDL_GetPerformanceCounter() - m_phaseStart[index];
+}
+/// @}
+
+/// @name 统计
+/// @{
+FrameProfiler::Stats FrameProfiler::getPhaseStats(ProfilePhase phase) const {
+    return computeStats(m_phaseHistory[static_cast<size_t>(phase)]);
+}
+
+FrameProfiler::Stats FrameProfiler::getFrameStats() const {
+    return computeStats(m_frameHistory);
+}
+
+const char *FrameProfiler::getPhaseName(ProfilePhase phase) {
+    // ImGui 默认字体不含中文字形，这里使用英文名称
+    switch (phase) {
+    case ProfilePhase::Input: return "Input";
+    case ProfilePhase::HandleInput: return "HandleInput";
+    case ProfilePhase::Update: return "Update";
+    case ProfilePhase::Dispatch: return "Dispatch";
+    case ProfilePhase::Render: return "Render";
+    case ProfilePhase::Submit: return "Submit";
+    case ProfilePhase::Present: return "Present";
+    default: return "Unknown";
+    }
+}
+
+FrameProfiler::Stats FrameProfiler::computeStats(const History &history) const {
+    Stats stats;
+    if (m_sampleCount == 0) return stats;
+    // 缓冲区未写满时有效数据位于 [0, m_sampleCount)，写满后整个缓冲区都有效
+    std::vector<float> samples(history.begin(), history.begin() + m_sampleCount);
+    stats.last = lastSample(history);
+    stats.min = *std::min_element(samples.begin(), samples.end());
+    float sum = 0.0f;
+    for (float sample : samples) sum += sample;
+    stats.avg = sum / static_cast<float>(samples.size());
+    auto p99Index = static_cast<size_t>(std::ceil(samples.size() * 0.99)) - 1;
+    std::nth_element(samples.begin(), samples.begin() + p99Index, samples.end());
+    stats.p99 = samples[p99Index];
+    return stats;
+}
+
+float FrameProfiler::lastSample(const History &history) const {
+    return history[(m_writeIndex + HISTORY_SIZE - 1) % HISTORY_SIZE];
+}
+/// @}
+
+void FrameProfiler::drawOverlay() {
+    if (!m_isVisible) return;
+
+    ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowBgAlpha(0.75f);
+    if (!ImGui::Begin("Frame Profiler", &m_isVisible, ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav)) {
+        ImGui::End();
+        return;
+    }
+
+    // 整帧曲线 (plot 的起始偏移设为写入位置，使曲线按时间顺序从左到右显示)
+    auto offset = static_cast<int>(m_sampleCount < HISTORY_SIZE ? 0 : m_writeIndex);
+    auto frameStats = getFrameStats();
+    ImGui::Text("Frame %.2f ms (%.0f FPS)", frameStats.avg, frameStats.avg > 0.0f ? 1000.0f / frameStats.avg : 0.0f);
+    ImGui::PlotLines("##frame", m_frameHistory.data(), static_cast<int>(m_sampleCount), offset, nullptr, 0.0f, frameStats.p99 * 1.5f, ImVec2(300.0f, 50.0f));
+
+    // 各阶段统计表
+    if (ImGui::BeginTable("phases", 5)) {
+        ImGui::TableSetupColumn("Phase");
+        ImGui::TableSetupColumn("Last");
+        ImGui::TableSetupColumn("Min");
+        ImGui::TableSetupColumn("Avg");
+        ImGui::TableSetupColumn("P99");
+        ImGui::TableHeadersRow();
+        auto addRow = [](const char *name, const Stats &stats) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(name);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", stats.last);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", stats.min);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", stats.avg);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", stats.p99);
+        };
+        for (size_t i = 0; i < PHASE_COUNT; ++i) {
+            addRow(getPhaseName(static_cast<ProfilePhase>(i)), getPhaseStats(static_cast<ProfilePhase>(i)));
+        }
+        addRow("Frame", frameStats);
+        ImGui::EndTable();
+    }
+
+    // 各阶段曲线
+    ImGui::Separator();
+    for (size_t i = 0; i < PHASE_COUNT; ++i) {
+        auto phase = static_cast<ProfilePhase>(i);
+        auto stats = getPhaseStats(phase);
+        ImGui::PushID(static_cast<int>(i));
+        ImGui::PlotLines(getPhaseName(phase), m_phaseHistory[i].data(), static_cast<int>(m_sampleCount), offset, nullptr, 0.0f, std::max(stats.p99 * 1.5f, 0.1f), ImVec2(300.0f, 30.0f));
+        ImGui::PopID();
+    }
+    ImGui::End();
+}
+
+} // namespace engine::debug
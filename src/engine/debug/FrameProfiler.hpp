@@ -0,0 +1,101 @@
+#pragma once
+#include <SDL3/SDL_stdinc.h>
+
+#include <array>
+#include <cstddef>
+
+namespace engine::debug {
+
+/**
+ * @enum ProfilePhase
+ * @brief Game::run 中一帧被计时的各个阶段
+ */
+enum class ProfilePhase {
+    Input,       ///< @brief InputManager::update (事件轮询与动作回调)
+    HandleInput, ///< @brief SceneManager::handleInput
+    Update,      ///< @brief SceneManager::update (固定步长模式下为本帧所有模拟步之和)
+    Dispatch,    ///< @brief dispatcher->update
+    Render,      ///< @brief SceneManager::render (录制绘制命令，流水线模式下在模拟线程)
+    Submit,      ///< @brief 清屏 + 提交绘制命令到 SDL (主线程)
+    Present,     ///< @brief SDL_RenderPresent
+    Count        ///< @brief 阶段数量，不是有效阶段
+};
+
+/**
+ * @brief 帧分析器，记录每帧各阶段的耗时
+ *
+ * 以环形缓冲区保存最近 HISTORY_SIZE 帧的数据，可通过 ImGui 叠加层显示曲线和 min/avg/p99 统计。
+ * 同一阶段在一帧内被多次计时时 (例如固定步长下多次 update)，耗时会累加。
+ */
+class FrameProfiler final {
+  public:
+    static constexpr size_t HISTORY_SIZE = 300; ///< @brief 保存的历史帧数
+    static constexpr size_t PHASE_COUNT = static_cast<size_t>(ProfilePhase::Count);
+
+    /// @brief 统计结果（毫秒）
+    struct Stats {
+        float last = 0.0f;
+        float min = 0.0f;
+        float avg = 0.0f;
+        float p99 = 0.0f;
+    };
+
+    /// @brief 作用域计时器，构造时开始、析构时结束一个阶段
+    class ScopedPhase final {
+      private:
+        FrameProfiler &m_profiler;
+        ProfilePhase m_phase;
+
+      public:
+        ScopedPhase(FrameProfiler &profiler, ProfilePhase phase) : m_profiler(profiler), m_phase(phase) { m_profiler.beginPhase(m_phase); }
+        ~ScopedPhase() { m_profiler.endPhase(m_phase); }
+
+        ScopedPhase(const ScopedPhase &) = delete;
+        ScopedPhase &operator=(const ScopedPhase &) = delete;
+        ScopedPhase(ScopedPhase &&) = delete;
+        ScopedPhase &operator=(ScopedPhase &&) = delete;
+    };
+
+  private:
+    using History = std::array<float, HISTORY_SIZE>;
+
+    std::array<History, PHASE_COUNT> m_phaseHistory{}; ///< @brief 各阶段的历史耗时（毫秒）
+    History m_frameHistory{};                          ///< @brief 整帧的历史耗时（毫秒）
+    std::array<Uint64, PHASE_COUNT> m_phaseTicks{};    ///< @brief 当前帧各阶段累计的计数器值
+    std::array<Uint64, PHASE_COUNT> m_phaseStart{};    ///< @brief 各阶段开始时的计数器值
+    Uint64 m_frameStart = 0;                           ///< @brief 当前帧开始时的计数器值
+    double m_ticksToMS = 0.0;                          ///< @brief 计数器值到毫秒的换算系数
+    size_t m_writeIndex = 0;                           ///< @brief 下一帧数据写入的位置
+    size_t m_sampleCount = 0;                          ///< @brief 已记录的有效帧数 (不超过 HISTORY_SIZE)
+    bool m_isVisible = false;                          ///< @brief 是否显示叠加层
+
+  public:
+    FrameProfiler();
+
+    FrameProfiler(const FrameProfiler &) = delete;
+    FrameProfiler &operator=(const FrameProfiler &) = delete;
+    FrameProfiler(FrameProfiler &&) = delete;
+    FrameProfiler &operator=(FrameProfiler &&) = delete;
+
+    void beginFrame();                   ///< @brief 开始一帧的计时
+    void endFrame();                     ///< @brief 结束一帧的计时，并把本帧数据写入环形缓冲区
+    void beginPhase(ProfilePhase phase); ///< @brief 开始某阶段的计时
+    void endPhase(ProfilePhase phase);   ///< @brief 结束某阶段的计时，耗时累加到当前帧
+
+    /// @brief 绘制 ImGui 叠加层 (需要在 ImGui::NewFrame 与 ImGui::Render 之间调用)
+    void drawOverlay();
+
+    Stats getPhaseStats(ProfilePhase phase) const;
+    Stats getFrameStats() const;
+    static const char *getPhaseName(ProfilePhase phase);
+
+    void setVisible(bool visible) { m_isVisible = visible; }
+    void toggleVisible() { m_isVisible = !m_isVisible; }
+    bool isVisible() const { return m_isVisible; }
+
+  private:
+    Stats computeStats(const History &history) const;
+    float lastSample(const History &history) const;
+};
+
+} // namespace engine::debug
@@ -0,0 +1,99 @@
+#include "FrameReport.hpp"
+
+#include <SDL3/SDL_cpuinfo.h>
+#include <SDL3/SDL_platform.h>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+#include <filesystem>
+#include <fstream>
+
+namespace engine::debug {
+
+namespace {
+/// @brief 把直方图导出为以毫秒为单位的统计对象
+nlohmann::ordered_json histogramToJson(const Histogram &histogram) {
+    return nlohmann::ordered_json{
+        {"count", histogram.getCount()},
+        {"mean_ms", histogram.getMean() / 1000.0},
+        {"p50_ms", histogram.getValueAtPercentile(50.0) / 1000.0},
+        {"p90_ms", histogram.getValueAtPercentile(90.0) / 1000.0},
+        {"p99_ms", histogram.getValueAtPercentile(99.0) / 1000.0},
+        {"p99_9_ms", histogram.getValueAtPercentile(99.9) / 1000.0},
+        {"max_ms", static_cast<double>(histogram.getMax()) / 1000.0}};
+}
+} // namespace
+
+void FrameReport::recordFrame(double frameTime, double limiterWaitTime) {
+    m_frameTimes.record(static_cast<Uint64>(frameTime * 1000000.0));
+    m_limiterWaits.record(static_cast<Uint64>(limiterWaitTime * 1000000.0));
+    if (m_stutterThresholdMS > 0.0 && frameTime * 1000.0 > m_stutterThresholdMS) {
+        ++m_stutterCount;
+    }
+}
+
+void FrameReport::reset() {
+    m_frameTimes.reset();
+    m_limiterWaits.reset();
+    m_stutterCount = 0;
+}
+
+bool FrameReport::writeJson(std::string_view filePath, const RunInfo &info) const {
+    std::ofstream file{std::filesystem::path(filePath)};
+    if (!file.is_open()) {
+        spdlog::error("FRAMEREPORT::writeJson::无法打开文件 '{}' 进行写入", filePath);
+        return false;
+    }
+
+    size_t totalObjects = 0;
+    size_t totalEntities = 0;
+    auto scenes = nlohmann::ordered_json::array();
+    for (const auto &scene : info.scenes) {
+        totalObjects += scene.objectCount;
+        totalEntities += scene.entityCount;
+        scenes.push_back({{"name", scene.name}, {"objects", scene.objectCount}, {"entities", scene.entityCount}});
+    }
+
+    nlohmann::ordered_json j{
+        {"scene", info.sceneName},
+        {"machine", {
+            {"platform", SDL_GetPlatform()},
+            {"logical_cores", SDL_GetNumLogicalCPUCores()},
+            {"system_ram_mb", SDL_GetSystemRAM()}
+        }},
+        {"settings", {
+            {"target_fps", info.targetFPS},
+            {"vsync", info.vsync},
+            {"fixed_timestep", info.fixedTimestep},
+            {"pipelined_render", info.pipelined},
+            {"headless", info.headless},
+            {"game_speed", info.gameSpeed}
+        }},
+        {"objects", {
+            {"total", totalObjects},
+            {"entities", totalEntities},
+            {"scenes", scenes}
+        }},
+        {"frame_time", histogramToJson(m_frameTimes)},
+        {"limiter_wait", histogramToJson(m_limiterWaits)},
+        {"stutter", {
+            {"threshold_ms", m_stutterThresholdMS},
+            {"count", m_stutterCount}
+        }}
+    };
+    try {
+        file << j.dump(4);
+    } catch (const std::exception &e) {
+        spdlog::error("FRAMEREPORT::writeJson::写入文件 '{}' 时出错: {}", filePath, e.what());
+        return false;
+    }
+    spdlog::info("FRAMEREPORT::writeJson::已导出 {} 帧的统计到 '{}' (p99 {:.2f} ms, 卡顿 {} 次)",
+                 m_frameTimes.getCount(), filePath, m_frameTimes.getValueAtPercentile(99.0) / 1000.0, m_stutterCount);
+    return true;
+}
+
+bool FrameReport::dump(const RunInfo &info) {
+    return writeJson("frame_report_" + std::to_string(m_dumpCount++) + ".json", info);
+}
+
+} // namespace engine::debug
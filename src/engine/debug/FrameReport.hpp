@@ -0,0 +1,79 @@
+#pragma once
+#include "Histogram.hpp"
+
+#include <SDL3/SDL_stdinc.h>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace engine::debug {
+
+/**
+ * @brief 整局运行的帧时间统计报告
+ *
+ * 与 FrameProfiler 只保留最近几百帧不同，这里用直方图记录整局所有帧的帧时间和限帧等待时间，
+ * 导出 p50 / p90 / p99 / p99.9 / max 与卡顿次数，便于在不同机器上的运行结果之间直接比较。
+ */
+class FrameReport final {
+  public:
+    /// @brief 场景栈中一个场景的信息
+    struct SceneInfo {
+        std::string name;       ///< @brief 场景名称
+        size_t objectCount = 0; ///< @brief 场景中的游戏对象数量
+        size_t entityCount = 0; ///< @brief 场景 registry 中的 ECS 实体数量
+    };
+
+    /// @brief 写入报告的运行环境信息，由 Game 在导出时收集
+    struct RunInfo {
+        std::string sceneName;         ///< @brief 栈顶场景名称 (场景不记录关卡文件路径)
+        std::vector<SceneInfo> scenes; ///< @brief 场景栈 (从栈底到栈顶)
+        int targetFPS = 0;             ///< @brief 目标帧率，0 表示不限帧
+        bool vsync = false;            ///< @brief 是否开启垂直同步
+        bool fixedTimestep = false;    ///< @brief 是否使用固定步长
+        bool pipelined = false;        ///< @brief 是否使用流水线渲染
+        bool headless = false;         ///< @brief 是否为无头模式
+        float gameSpeed = 1.0f;        ///< @brief 游戏速度倍率，0 表示最大速度
+    };
+
+  private:
+    Histogram m_frameTimes;            ///< @brief 帧时间 (微秒)
+    Histogram m_limiterWaits;          ///< @brief 每帧在 Time::limitFrameRate 中等待的时间 (微秒)
+    double m_stutterThresholdMS = 0.0; ///< @brief 帧时间超过该值记为一次卡顿，0 表示不统计
+    Uint64 m_stutterCount = 0;         ///< @brief 卡顿次数
+    int m_dumpCount = 0;               ///< @brief 已导出的次数，用于生成文件名
+
+  public:
+    FrameReport() = default;
+
+    FrameReport(const FrameReport &) = delete;
+    FrameReport &operator=(const FrameReport &) = delete;
+    FrameReport(FrameReport &&) = delete;
+    FrameReport &operator=(FrameReport &&) = delete;
+
+    /**
+     * @brief 记录一帧
+     * @param frameTime 帧时间 (秒)，包含限帧等待
+     * @param limiterWaitTime 本帧限帧器等待的时间 (秒)
+     */
+    void recordFrame(double frameTime, double limiterWaitTime);
+    void reset(); ///< @brief 清空所有统计
+
+    /**
+     * @brief 把统计结果写入 JSON 文件
+     * @param filePath 输出文件路径
+     * @param info 运行环境信息
+     * @return 是否写入成功
+     */
+    bool writeJson(std::string_view filePath, const RunInfo &info) const;
+    /// @brief 以自增编号生成文件名 (frame_report_0.json, frame_report_1.json ...) 并导出
+    bool dump(const RunInfo &info);
+
+    void setStutterThreshold(double thresholdMS) { m_stutterThresholdMS = thresholdMS; }
+    double getStutterThreshold() const { return m_stutterThresholdMS; }
+    Uint64 getFrameCount() const { return m_frameTimes.getCount(); }
+    Uint64 getStutterCount() const { return m_stutterCount; }
+};
+
+} // namespace engine::debug
@@ -0,0 +1,64 @@
+#include "Histogram.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace engine::debug {
+
+void Histogram::record(Uint64 valueUS) {
+    valueUS = std::min(valueUS, MAX_VALUE);
+    ++m_counts[indexOf(valueUS)];
+    ++m_totalCount;
+    m_maxValue = std::max(m_maxValue, valueUS);
+    m_sum += static_cast<double>(valueUS);
+}
+
+void Histogram::reset() {
+    m_counts.fill(0);
+    m_totalCount = 0;
+    m_maxValue = 0;
+    m_sum = 0.0;
+}
+
+double Histogram::getValueAtPercentile(double percentile) const {
+    if (m_totalCount == 0) return 0.0;
+    percentile = std::clamp(percentile, 0.0, 100.0);
+    // 第 rank 个样本 (从 1 开始) 所在的桶
+    auto rank = std::max<Uint64>(static_cast<Uint64>(std::ceil(percentile / 100.0 * static_cast<double>(m_totalCount))), 1);
+    Uint64 seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += m_counts[i];
+        if (seen >= rank) {
+            // 取桶中点，但不超过记录过的最大值
+            double value = static_cast<double>(lowestValueAt(i)) + static_cast<double>(bucketWidthAt(i)) / 2.0;
+            return std::min(value, static_cast<double>(m_maxValue));
+        }
+    }
+    return static_cast<double>(m_maxValue);
+}
+
+size_t Histogram::indexOf(Uint64 value) {
+    if (value < SUB_BUCKET_COUNT) return static_cast<size_t>(value);
+    // value 的最高位为 msb，右移 shift 位后落在 [SUB_BUCKET_HALF, SUB_BUCKET_COUNT) 内
+    int msb = static_cast<int>(std::bit_width(value)) - 1;
+    int shift = msb - (SUB_BUCKET_BITS - 1);
+    auto subBucket = static_cast<size_t>(value >> shift);
+    return SUB_BUCKET_COUNT + static_cast<size_t>(shift - 1) * SUB_BUCKET_HALF + (subBucket - SUB_BUCKET_HALF);
+}
+
+Uint64 Histogram::lowestValueAt(size_t index) {
+    if (index < SUB_BUCKET_COUNT) return index;
+    size_t relative = index - SUB_BUCKET_COUNT;
+    int shift = static_cast<int>(relative / SUB_BUCKET_HALF) + 1;
+    Uint64 subBucket = relative % SUB_BUCKET_HALF + SUB_BUCKET_HALF;
+    return subBucket << shift;
+}
+
+Uint64 Histogram::bucketWidthAt(size_t index) {
+    if (index < SUB_BUCKET_COUNT) return 1;
+    int shift = static_cast<int>((index - SUB_BUCKET_COUNT) / SUB_BUCKET_HALF) + 1;
+    return Uint64{1} << shift;
+}
+
+} // namespace engine::debug
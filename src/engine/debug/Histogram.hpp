@@ -0,0 +1,54 @@
+#pragma once
+#include <SDL3/SDL_stdinc.h>
+
+#include <array>
+#include <cstddef>
+
+namespace engine::debug {
+
+/**
+ * @brief HDR 风格的对数-线性直方图，用于统计帧时间等长尾分布
+ *
+ * 数值以微秒为单位记录。小于 SUB_BUCKET_COUNT 的值每个整数一个桶；更大的值按 2 的幂分段，
+ * 每段再线性细分为 SUB_BUCKET_COUNT / 2 个桶，因此任意量级的相对误差都不超过 1 / 64 (约 1.6%)。
+ * 桶数固定 (约 1.3k 个)，记录为 O(1) 且不分配内存，适合每帧调用并长时间运行。
+ */
+class Histogram final {
+  public:
+    static constexpr int SUB_BUCKET_BITS = 7;                              ///< @brief 每段的精度位数
+    static constexpr size_t SUB_BUCKET_COUNT = size_t{1} << SUB_BUCKET_BITS; ///< @brief 线性区间的桶数 (128)
+    static constexpr size_t SUB_BUCKET_HALF = SUB_BUCKET_COUNT / 2;          ///< @brief 之后每段的桶数 (64)
+    static constexpr Uint64 MAX_VALUE = 60ull * 1000000ull;                  ///< @brief 可记录的最大值 (60 秒)，更大的值按最大值计
+
+  private:
+    static constexpr int MAX_SHIFT = 19; ///< @brief MAX_VALUE 所在段的移位数 (2^25 <= 6e7 < 2^26)
+    static constexpr size_t BUCKET_COUNT = SUB_BUCKET_COUNT + MAX_SHIFT * SUB_BUCKET_HALF;
+
+    std::array<Uint64, BUCKET_COUNT> m_counts{}; ///< @brief 各桶的计数
+    Uint64 m_totalCount = 0;                     ///< @brief 记录的样本总数
+    Uint64 m_maxValue = 0;                       ///< @brief 记录过的最大值 (精确值)
+    double m_sum = 0.0;                          ///< @brief 样本总和，用于计算均值
+
+  public:
+    Histogram() = default;
+
+    void record(Uint64 valueUS); ///< @brief 记录一个样本 (微秒)
+    void reset();                ///< @brief 清空所有样本
+
+    /**
+     * @brief 计算百分位数
+     * @param percentile 百分位，范围 [0, 100]，例如 99.9
+     * @return 对应样本所在桶的中间值 (微秒)，没有样本时返回 0
+     */
+    double getValueAtPercentile(double percentile) const;
+    double getMean() const { return m_totalCount > 0 ? m_sum / static_cast<double>(m_totalCount) : 0.0; }
+    Uint64 getMax() const { return m_maxValue; }
+    Uint64 getCount() const { return m_totalCount; }
+
+  private:
+    static size_t indexOf(Uint64 value);       ///< @brief 数值对应的桶索引
+    static Uint64 lowestValueAt(size_t index); ///< @brief 桶的下界
+    static Uint64 bucketWidthAt(size_t index); ///< @brief 桶的宽度
+};
+
+} // namespace engine::debug
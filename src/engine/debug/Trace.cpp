@@ -0,0 +1,150 @@
+#include "Trace.hpp"
+
+#include <SDL3/SDL_timer.h>
+#include <spdlog/spdlog.h>
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace engine::debug {
+
+namespace {
+constexpr size_t MAX_EVENTS_PER_THREAD = 1 << 20; // 每个线程最多缓存的事件数，超出后丢弃并警告一次
+
+/// @brief 一个已完成的区段 ("ph": "X")
+struct TraceEvent {
+    const char *name;
+    Uint64 startNS;
+    Uint64 durationNS;
+};
+
+/// @brief 单个线程的事件缓冲区
+struct ThreadBuffer {
+    std::mutex mutex;
+    std::vector<TraceEvent> events;
+    std::string threadName;
+    int threadID = 0;
+    bool overflowWarned = false;
+};
+
+/// @brief 所有线程缓冲区的注册表 (线程退出后缓冲区仍保留，直到程序结束)
+struct TraceRegistry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    std::atomic<bool> enabled = true;
+    int dumpCount = 0;
+};
+
+TraceRegistry &registry() {
+    static TraceRegistry instance;
+    return instance;
+}
+
+ThreadBuffer &threadBuffer() {
+    thread_local std::shared_ptr<ThreadBuffer> buffer = [] {
+        auto newBuffer = std::make_shared<ThreadBuffer>();
+        auto &reg = registry();
+        std::lock_guard lock(reg.mutex);
+        newBuffer->threadID = static_cast<int>(reg.buffers.size());
+        newBuffer->threadName = newBuffer->threadID == 0 ? "Main" : "Thread " + std::to_string(newBuffer->threadID);
+        newBuffer->events.reserve(4096);
+        reg.buffers.push_back(newBuffer);
+        return newBuffer;
+    }();
+    return *buffer;
+}
+} // namespace
+
+void Trace::setEnabled(bool enabled) {
+    registry().enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Trace::isEnabled() {
+    return registry().enabled.load(std::memory_order_relaxed);
+}
+
+void Trace::setThreadName(std::string_view name) {
+    auto &buffer = threadBuffer();
+    std::lock_guard lock(buffer.mutex);
+    buffer.threadName = name;
+}
+
+void Trace::record(const char *name, Uint64 startNS, Uint64 endNS) {
+    auto &buffer = threadBuffer();
+    std::lock_guard lock(buffer.mutex);
+    if (buffer.events.size() >= MAX_EVENTS_PER_THREAD) {
+        if (!buffer.overflowWarned) {
+            spdlog::warn("TRACE::record::线程 '{}' 的追踪缓冲区已满 ({} 个事件), 后续事件将被丢弃, 请先导出", buffer.threadName, MAX_EVENTS_PER_THREAD);
+            buffer.overflowWarned = true;
+        }
+        return;
+    }
+    buffer.events.push_back({name, startNS, endNS - startNS});
+}
+
+bool Trace::writeChromeTrace(std::string_view filePath) {
+    std::ofstream file{std::filesystem::path(filePath)};
+    if (!file.is_open()) {
+        spdlog::error("TRACE::writeChromeTrace::无法打开文件 '{}' 进行写入", filePath);
+        return false;
+    }
+
+    // 先在锁内取出所有线程的事件，写文件时不阻塞记录线程
+    std::vector<std::pair<std::shared_ptr<ThreadBuffer>, std::vector<TraceEvent>>> snapshots;
+    {
+        auto &reg = registry();
+        std::lock_guard lock(reg.mutex);
+        for (auto &buffer : reg.buffers) {
+            std::lock_guard bufferLock(buffer->mutex);
+            snapshots.emplace_back(buffer, std::move(buffer->events));
+            buffer->events.clear();
+            buffer->overflowWarned = false;
+        }
+    }
+
+    // 区段名称均为代码中的字符串字面量，不包含需要转义的字符，这里直接手写 JSON 以避免构建巨大的 json 对象
+    size_t eventCount = 0;
+    file << "{\"traceEvents\":[\n";
+    bool first = true;
+    for (const auto &[buffer, events] : snapshots) {
+        if (!first) file << ",\n";
+        first = false;
+        file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadID
+             << ",\"args\":{\"name\":\"" << buffer->threadName << "\"}}";
+        for (const auto &event : events) {
+            // Chrome trace 的时间单位为微秒
+            file << ",\n{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadID
+                 << ",\"ts\":" << static_cast<double>(event.startNS) / 1000.0
+                 << ",\"dur\":" << static_cast<double>(event.durationNS) / 1000.0 << "}";
+        }
+        eventCount += events.size();
+    }
+    file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    spdlog::info("TRACE::writeChromeTrace::已导出 {} 个追踪事件到 '{}'", eventCount, filePath);
+    return true;
+}
+
+bool Trace::dump() {
+    int index;
+    {
+        auto &reg = registry();
+        std::lock_guard lock(reg.mutex);
+        index = reg.dumpCount++;
+    }
+    return writeChromeTrace("trace_" + std::to_string(index) + ".json");
+}
+
+TraceZone::TraceZone(const char *name) : m_name(name), m_startNS(Trace::isEnabled() ? SDL_GetTicksNS() : 0) {}
+
+TraceZone::~TraceZone() {
+    if (m_startNS != 0 && Trace::isEnabled()) {
+        Trace::record(m_name, m_startNS, SDL_GetTicksNS());
+    }
+}
+
+} // namespace engine::debug
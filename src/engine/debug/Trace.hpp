@@ -0,0 +1,73 @@
+#pragma once
+#include <SDL3/SDL_stdinc.h>
+
+#include <string>
+#include <string_view>
+
+/**
+ * @file Trace.hpp
+ * @brief 作用域追踪区段，导出为 Chrome trace-event 格式 (chrome://tracing 或 Perfetto 中打开)
+ *
+ * 用法: 在需要计时的作用域开头写 ENGINE_TRACE_ZONE("Scene::update");
+ * 名称必须是字符串字面量 (只保存指针)。未定义 ENGINE_ENABLE_TRACE 时宏展开为空，没有任何开销。
+ */
+
+namespace engine::debug {
+
+/**
+ * @brief 追踪事件的全局记录器
+ *
+ * 每个线程第一次记录事件时会创建自己的缓冲区，记录时只锁自己的缓冲区 (仅在导出时与导出线程竞争)，
+ * 因此各线程之间互不阻塞。
+ */
+class Trace final {
+  public:
+    Trace() = delete;
+
+    static void setEnabled(bool enabled);             ///< @brief 开启或暂停记录
+    static bool isEnabled();                          ///< @brief 是否正在记录
+    static void setThreadName(std::string_view name); ///< @brief 设置当前线程在追踪视图中显示的名称
+    /**
+     * @brief 记录一个完整区段 (通常由 TraceZone 调用)
+     * @param name 区段名称，必须在程序生命周期内有效 (字符串字面量)
+     * @param startNS 开始时间 (SDL_GetTicksNS)
+     * @param endNS 结束时间 (SDL_GetTicksNS)
+     */
+    static void record(const char *name, Uint64 startNS, Uint64 endNS);
+
+    /**
+     * @brief 把目前所有线程记录的事件写入 Chrome trace JSON 文件，并清空缓冲区
+     * @param filePath 输出文件路径
+     * @return 是否写入成功
+     */
+    static bool writeChromeTrace(std::string_view filePath);
+    /// @brief 以自增编号生成文件名 (trace_0.json, trace_1.json ...) 并导出
+    static bool dump();
+};
+
+/// @brief RAII 追踪区段，构造时记录开始时间，析构时提交事件
+class TraceZone final {
+  private:
+    const char *m_name;
+    Uint64 m_startNS;
+
+  public:
+    explicit TraceZone(const char *name);
+    ~TraceZone();
+
+    TraceZone(const TraceZone &) = delete;
+    TraceZone &operator=(const TraceZone &) = delete;
+    TraceZone(TraceZone &&) = delete;
+    TraceZone &operator=(TraceZone &&) = delete;
+};
+
+} // namespace engine::debug
+
+#define ENGINE_TRACE_CONCAT_IMPL(a, b) a##b
+#define ENGINE_TRACE_CONCAT(a, b) ENGINE_TRACE_CONCAT_IMPL(a, b)
+
+#ifdef ENGINE_ENABLE_TRACE
+#define ENGINE_TRACE_ZONE(name) ::engine::debug::TraceZone ENGINE_TRACE_CONCAT(traceZone_, __LINE__)(name)
+#else
+#define ENGINE_TRACE_ZONE(name) ((void)0)
+#endif
@@ -0,0 +1,89 @@
+#pragma once
+#include "../component/TilelayerComponent.hpp"
+#include "../render/RenderCommand.hpp"
+#include "../render/Sprite.hpp"
+#include "../utils/Alignment.hpp"
+
+#include <glm/vec2.hpp>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::render {
+class Animation;
+}
+
+/**
+ * @brief 基于 entt::registry 的数据导向对象模型
+ *
+ * 与 GameObject + 虚函数组件不同，这里的组件都是可移动的纯数据结构，按类型存放在 registry 的紧凑数组中，
+ * 由 Systems.hpp 中的系统函数通过 view 批量遍历。适合数量巨大、行为简单的实体 (敌人、子弹、瓦片层等)。
+ */
+namespace engine::ecs {
+
+/// @brief 实体名称 (调试与查找用)
+struct Name {
+    std::string value;
+};
+
+/// @brief 位置、缩放、旋转，以及用于渲染插值的上一次模拟位置
+struct Transform {
+    glm::vec2 position = {0.0f, 0.0f};         ///< @brief 2D空间中的位置坐标
+    glm::vec2 scale = {1.0f, 1.0f};            ///< @brief X和Y轴上的缩放比例
+    float rotation = 0.0f;                     ///< @brief 旋转角度（角度制）
+    glm::vec2 previousPosition = {0.0f, 0.0f}; ///< @brief 上一次模拟更新前的位置，用于渲染插值
+
+    /// @brief 获取渲染用的插值位置
+    glm::vec2 getInterpolatedPosition(float alpha) const { return previousPosition + (position - previousPosition) * alpha; }
+};
+
+/// @brief 精灵，尺寸与偏移在创建和源矩形变化时计算，渲染时直接使用
+struct Sprite {
+    engine::render::Sprite sprite;                                          ///< @brief 精灵对象
+    glm::vec2 size = {0.0f, 0.0f};                                          ///< @brief 精灵尺寸 (未缩放)
+    glm::vec2 offset = {0.0f, 0.0f};                                        ///< @brief 左上角相对 Transform 位置的偏移 (已缩放)
+    engine::utils::Alignment alignment = engine::utils::Alignment::NONE;    ///< @brief 对齐方式
+    bool isHidden = false;                                                  ///< @brief 是否隐藏（不渲染）
+    engine::render::RenderLayer layer = engine::render::RenderLayer::Units; ///< @brief 渲染图层
+};
+
+/// @brief 动画名称到 Animation 的映射。同一类实体共享一份 (只读)，避免每个实体重复持有帧数据
+using AnimationClips = std::unordered_map<std::string, std::unique_ptr<engine::render::Animation>>;
+
+/// @brief 动画播放状态，驱动同一实体上 Sprite 的源矩形
+struct Animator {
+    std::shared_ptr<const AnimationClips> clips;        ///< @brief 共享的动画集合
+    const engine::render::Animation *current = nullptr; ///< @brief 当前播放的动画
+    float timer = 0.0f;                                 ///< @brief 动画播放中的计时器
+    bool isPlaying = false;                             ///< @brief 当前是否有动画正在播放
+    bool isOneShotRemoval = false;                      ///< @brief 是否在动画结束后删除实体
+};
+
+/// @brief 生命值与受伤后的无敌时间
+struct Health {
+    int maxHealth = 1;                  ///< @brief 最大生命值
+    int currentHealth = 1;              ///< @brief 当前生命值
+    bool isInvincible = false;          ///< @brief 是否处于无敌状态
+    float invincibilityDuration = 2.0f; ///< @brief 受伤后无敌的总时长（秒）
+    float invincibilityTimer = 0.0f;    ///< @brief 无敌时间计时器（秒）
+
+    bool isAlive() const { return currentHealth > 0; }
+};
+
+/// @brief 瓦片地图层 (瓦片层不需要 Transform，偏移量即世界位置)
+struct TileLayer {
+    glm::ivec2 tileSize = {0, 0};                                            ///< @brief 单个瓦片尺寸（像素）
+    glm::ivec2 mapSize = {0, 0};                                             ///< @brief 地图尺寸（瓦片数）
+    std::vector<engine::component::TileInfo> tiles;                          ///< @brief 瓦片信息 (行主序, index = y * mapSize.x + x)
+    glm::vec2 offset = {0.0f, 0.0f};                                         ///< @brief 瓦片层在世界中的偏移量
+    bool isHidden = false;                                                   ///< @brief 是否隐藏（不渲染）
+    engine::render::RenderLayer layer = engine::render::RenderLayer::Ground; ///< @brief 渲染图层
+    glm::vec2 maxOverhang = {0.0f, 0.0f};                                    ///< @brief 瓦片的最大伸出量，用于计算可见范围 (EntityFactory 计算)
+};
+
+/// @brief 删除标记 (空标签)，在每次更新的最后由 destroyMarkedEntities 统一销毁
+struct NeedRemove {};
+
+} // namespace engine::ecs
@@ -0,0 +1,102 @@
+#include "EntityFactory.hpp"
+#include "PrototypeCache.hpp"
+#include "../resource/ResourceManager.hpp"
+#include "Systems.hpp"
+
+#include <entt/entity/registry.hpp>
+#include <glm/common.hpp>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+namespace engine::ecs {
+
+EntityFactory::EntityFactory(entt::registry &registry, engine::resource::ResourceManager &resourceManager)
+    : m_registry(registry), m_resourceManager(resourceManager) {}
+
+entt::entity EntityFactory::create(std::string_view name) {
+    auto entity = m_registry.create();
+    m_registry.emplace<Name>(entity, std::string(name));
+    return entity;
+}
+
+void EntityFactory::destroy(entt::entity entity) {
+    if (!m_registry.valid(entity)) {
+        spdlog::warn("ENTITYFACTORY::destroy::WARN::实体无效或已被销毁");
+        return;
+    }
+    m_registry.emplace_or_replace<NeedRemove>(entity);
+}
+
+Transform &EntityFactory::addTransform(entt::entity entity, glm::vec2 position, glm::vec2 scale, float rotation) {
+    return m_registry.emplace_or_replace<Transform>(entity, position, scale, rotation, position);
+}
+
+Sprite &EntityFactory::addSprite(entt::entity entity, engine::render::Sprite sprite, engine::utils::Alignment alignment) {
+    // 尺寸: 有源矩形则取源矩形，否则取整张纹理
+    glm::vec2 size = sprite.getSourceRect().has_value()
+                         ? glm::vec2{sprite.getSourceRect()->w, sprite.getSourceRect()->h}
+                         : m_resourceManager.getTextureSize(sprite.getTextureID());
+    const auto *transform = m_registry.try_get<Transform>(entity);
+    if (!transform) {
+        spdlog::warn("ENTITYFACTORY::addSprite::实体 '{}' 没有 Transform，精灵将无法渲染",
+                     m_registry.all_of<Name>(entity) ? m_registry.get<Name>(entity).value : "未知");
+    }
+    glm::vec2 scale = transform ? transform->scale : glm::vec2{1.0f, 1.0f};
+    glm::vec2 offset = engine::utils::getAlignmentOffset(alignment, size * scale);
+    return m_registry.emplace_or_replace<Sprite>(entity, std::move(sprite), size, offset, alignment, false);
+}
+
+Sprite &EntityFactory::addSprite(entt::entity entity, std::string_view textureID, engine::utils::Alignment alignment,
+                                 std::optional<SDL_FRect> sourceRectOpt, bool isFlipped) {
+    return addSprite(entity, engine::render::Sprite(textureID, sourceRectOpt, isFlipped), alignment);
+}
+
+Animator &EntityFactory::addAnimator(entt::entity entity, std::shared_ptr<const AnimationClips> clips, std::string_view initialAnimation) {
+    auto &animator = m_registry.emplace_or_replace<Animator>(entity);
+    animator.clips = std::move(clips);
+    auto *sprite = m_registry.try_get<Sprite>(entity);
+    if (!sprite) {
+        spdlog::error("ENTITYFACTORY::addAnimator::实体 '{}' 的 Animator 需要 Sprite, 但未找到。",
+                      m_registry.all_of<Name>(entity) ? m_registry.get<Name>(entity).value : "未知");
+    }
+    if (!initialAnimation.empty()) {
+        const auto *transform = m_registry.try_get<Transform>(entity);
+        playAnimation(animator, sprite, initialAnimation, transform ? transform->scale : glm::vec2{1.0f, 1.0f});
+    }
+    return animator;
+}
+
+Health &EntityFactory::addHealth(entt::entity entity, int maxHealth, float invincibilityDuration) {
+    maxHealth = std::max(1, maxHealth); // 确保最大生命值至少为 1
+    return m_registry.emplace_or_replace<Health>(entity, maxHealth, maxHealth, false, invincibilityDuration, 0.0f);
+}
+
+TileLayer &EntityFactory::addTileLayer(entt::entity entity, glm::ivec2 tileSize, glm::ivec2 mapSize, std::vector<engine::component::TileInfo> &&tiles) {
+    if (tiles.size() != static_cast<size_t>(mapSize.x * mapSize.y)) {
+        spdlog::error("ENTITYFACTORY::addTileLayer::地图尺寸与提供的瓦片向量大小不匹配。瓦片数据将被清除。");
+        tiles.clear();
+        mapSize = {0, 0};
+    }
+    auto &layer = m_registry.emplace_or_replace<TileLayer>(entity, tileSize, mapSize, std::move(tiles));
+    for (const auto &tileInfo : layer.tiles) {
+        layer.maxOverhang = glm::max(layer.maxOverhang, engine::component::getTileOverhang(tileInfo, tileSize));
+    }
+    return layer;
+}
+
+entt::entity EntityFactory::spawn(const Prototype &prototype, glm::vec2 position) {
+    auto entity = m_registry.create();
+    m_registry.emplace<Name>(entity, prototype.name);
+    m_registry.emplace<Transform>(entity, position, prototype.scale, 0.0f, position);
+    m_registry.emplace<Sprite>(entity, prototype.sprite);
+    if (prototype.clips) {
+        m_registry.emplace<Animator>(entity, prototype.clips, prototype.initialAnimation, 0.0f, prototype.initialAnimation != nullptr, prototype.isOneShotRemoval);
+    }
+    if (prototype.hp > 0) {
+        m_registry.emplace<Health>(entity, prototype.hp, prototype.hp, false, 0.0f, 0.0f);
+    }
+    return entity;
+}
+
+} // namespace engine::ecs
@@ -0,0 +1,81 @@
+#pragma once
+#include "Components.hpp"
+
+#include <SDL3/SDL_rect.h>
+#include <entt/entity/fwd.hpp>
+#include <glm/vec2.hpp>
+
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace engine::resource {
+class ResourceManager;
+}
+
+namespace engine::ecs {
+struct Prototype;
+
+/**
+ * @brief 在 entt::registry 中创建实体并挂载组件的适配器
+ *
+ * 对应 GameObject::addComponent + Component::init 的职责：组件之间的派生数据 (精灵尺寸、对齐偏移、
+ * 动画首帧等) 在这里一次算好，系统函数每帧只读写纯数据。Scene 与 LevelLoader 通过它创建实体。
+ */
+class EntityFactory final {
+  private:
+    entt::registry &m_registry;                           ///< @brief 目标 registry (通常属于某个 Scene)
+    engine::resource::ResourceManager &m_resourceManager; ///< @brief 资源管理器，用于获取纹理尺寸
+
+  public:
+    EntityFactory(entt::registry &registry, engine::resource::ResourceManager &resourceManager);
+
+    /**
+     * @brief 创建一个只带名称的实体
+     * @param name 实体名称
+     * @return 新实体
+     */
+    entt::entity create(std::string_view name);
+    /// @brief 标记实体待删除 (在本次更新结束时销毁)
+    void destroy(entt::entity entity);
+
+    Transform &addTransform(entt::entity entity, glm::vec2 position = {0.0f, 0.0f}, glm::vec2 scale = {1.0f, 1.0f}, float rotation = 0.0f);
+    /**
+     * @brief 添加精灵，并根据纹理或源矩形计算尺寸与对齐偏移 (需先添加 Transform 才会应用缩放)
+     * @param entity 目标实体
+     * @param sprite 精灵对象
+     * @param alignment 对齐方式
+     */
+    Sprite &addSprite(entt::entity entity, engine::render::Sprite sprite, engine::utils::Alignment alignment = engine::utils::Alignment::NONE);
+    Sprite &addSprite(entt::entity entity, std::string_view textureID, engine::utils::Alignment alignment = engine::utils::Alignment::NONE,
+                      std::optional<SDL_FRect> sourceRectOpt = std::nullopt, bool isFlipped = false);
+    /**
+     * @brief 添加动画 (需先添加 Sprite)
+     * @param entity 目标实体
+     * @param clips 共享的动画集合
+     * @param initialAnimation 立即播放的动画名称，为空则不播放
+     */
+    Animator &addAnimator(entt::entity entity, std::shared_ptr<const AnimationClips> clips, std::string_view initialAnimation = {});
+    Health &addHealth(entt::entity entity, int maxHealth = 1, float invincibilityDuration = 2.0f);
+    /**
+     * @brief 添加瓦片层
+     * @param entity 目标实体
+     * @param tileSize 单个瓦片尺寸（像素）
+     * @param mapSize 地图尺寸（瓦片数）
+     * @param tiles 瓦片数据 (会被移动)，数量与 mapSize 不匹配时清空
+     */
+    TileLayer &addTileLayer(entt::entity entity, glm::ivec2 tileSize, glm::ivec2 mapSize, std::vector<engine::component::TileInfo> &&tiles);
+    /**
+     * @brief 按编译好的原型生成实体 (Name、Transform、Sprite，有动画时加 Animator (特效播放完后删除)，hp > 0 时加 Health)
+     * @param prototype 原型 (来自 PrototypeCache)
+     * @param position 初始位置
+     * @return 新实体
+     * @note 只复制预先算好的数据，不访问 JSON、不查询纹理、不构建动画帧
+     */
+    entt::entity spawn(const Prototype &prototype, glm::vec2 position);
+
+    entt::registry &getRegistry() const { return m_registry; }
+};
+
+} // namespace engine::ecs
@@ -0,0 +1,174 @@
+#include "PrototypeCache.hpp"
+#include "../render/Animation.hpp"
+#include "../resource/ResourceManager.hpp"
+
+#include <entt/core/hashed_string.hpp>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+#include <fstream>
+
+namespace engine::ecs {
+
+namespace {
+entt::id_type hashOf(std::string_view str) {
+    return entt::hashed_string::value(str.data(), str.size());
+}
+} // namespace
+
+float Prototype::getStat(entt::id_type id, float fallback) const {
+    auto it = stats.find(id);
+    return it != stats.end() ? it->second : fallback;
+}
+
+std::string_view Prototype::getProperty(entt::id_type id) const {
+    auto it = properties.find(id);
+    return it != properties.end() ? std::string_view(it->second) : std::string_view{};
+}
+
+PrototypeCache::PrototypeCache(engine::resource::ResourceManager &resourceManager) : m_resourceManager(resourceManager) {}
+
+PrototypeCache::~PrototypeCache() = default;
+
+bool PrototypeCache::loadFile(std::string_view category, std::string_view path) {
+    std::ifstream file{std::string(path)};
+    if (!file.is_open()) {
+        spdlog::error("PROTOTYPECACHE::loadFile::无法打开数据文件: {}", path);
+        return false;
+    }
+    nlohmann::json jsonData;
+    try {
+        file >> jsonData;
+    } catch (const nlohmann::json::parse_error &e) {
+        spdlog::error("PROTOTYPECACHE::loadFile::解析 JSON 数据失败: {} (at byte {})", e.what(), e.byte);
+        return false;
+    }
+    if (!jsonData.is_object()) {
+        spdlog::error("PROTOTYPECACHE::loadFile::数据文件的根节点必须是对象: {}", path);
+        return false;
+    }
+
+    auto &prototypes = m_categories[hashOf(category)];
+    bool isEffect = category == "effect"; // 特效播放一次后删除，其余类别的动画默认循环
+    for (const auto &[key, data] : jsonData.items()) {
+        if (!data.is_object()) {
+            spdlog::warn("PROTOTYPECACHE::loadFile::条目 '{}' 不是对象，已跳过", key);
+            continue;
+        }
+        prototypes[hashOf(key)] = compile(key, data, isEffect);
+    }
+    spdlog::info("PROTOTYPECACHE::loadFile::类别 '{}' 编译了 {} 个原型: {}", category, prototypes.size(), path);
+    return true;
+}
+
+const Prototype *PrototypeCache::get(entt::id_type category, entt::id_type key) const {
+    auto categoryIt = m_categories.find(category);
+    if (categoryIt == m_categories.end()) return nullptr;
+    auto it = categoryIt->second.find(key);
+    return it != categoryIt->second.end() ? it->second.get() : nullptr;
+}
+
+const Prototype *PrototypeCache::get(std::string_view category, std::string_view key) const {
+    return get(hashOf(category), hashOf(key));
+}
+
+size_t PrototypeCache::getPrototypeCount() const {
+    size_t count = 0;
+    for (const auto &[id, prototypes] : m_categories) {
+        count += prototypes.size();
+    }
+    return count;
+}
+
+void PrototypeCache::clear() {
+    m_categories.clear();
+}
+
+std::unique_ptr<Prototype> PrototypeCache::compile(std::string_view key, const nlohmann::json &data, bool isEffect) {
+    auto prototype = std::make_unique<Prototype>();
+    prototype->key = key;
+    prototype->name = data.value("name", std::string(key));
+
+    // 1. 属性: 通用战斗属性单独存放，其余字段按类型放入哈希表
+    prototype->hp = data.value("hp", 0);
+    prototype->attack = data.value("atk", 0);
+    prototype->defense = data.value("def", 0);
+    prototype->range = data.value("range", 0.0f);
+    prototype->attackInterval = data.value("atk_interval", 0.0f);
+    prototype->speed = data.value("speed", 0.0f);
+    prototype->isFacingRight = data.value("face_right", true);
+    for (const auto &[field, value] : data.items()) {
+        if (value.is_number()) {
+            prototype->stats[hashOf(field)] = value.get<float>();
+        } else if (value.is_boolean()) {
+            prototype->stats[hashOf(field)] = value.get<bool>() ? 1.0f : 0.0f;
+        } else if (value.is_string()) {
+            prototype->properties[hashOf(field)] = value.get<std::string>();
+        }
+    }
+    if (data.contains("sounds") && data["sounds"].is_object()) {
+        for (const auto &[event, soundID] : data["sounds"].items()) {
+            if (soundID.is_string()) prototype->sounds[hashOf(event)] = soundID.get<std::string>();
+        }
+    }
+
+    // 2. 精灵: 纹理在这里加载一次，帧尺寸缺省时使用整张纹理
+    std::string textureID = data.value("sprite_sheet", "");
+    if (textureID.empty()) {
+        spdlog::warn("PROTOTYPECACHE::compile::原型 '{}' 没有 sprite_sheet", key);
+        return prototype;
+    }
+    glm::vec2 textureSize = m_resourceManager.getTextureSize(textureID);
+    glm::vec2 frameSize = {data.value("width", textureSize.x), data.value("height", textureSize.y)};
+    glm::vec2 origin = {data.value("x", 0.0f), data.value("y", 0.0f)};
+    glm::vec2 displaySize = {data.value("size_x", frameSize.x), data.value("size_y", frameSize.y)};
+    if (frameSize.x > 0.0f && frameSize.y > 0.0f) {
+        prototype->scale = displaySize / frameSize;
+    }
+
+    // 3. 动画: 帧源矩形 = 起点 + (列, 行) * 帧尺寸。单个动画 (effect_data) 直接写在 animation 下，命名为 "default"
+    auto clips = std::make_shared<AnimationClips>();
+    auto addClip = [&](std::string_view clipName, const nlohmann::json &clipJson) {
+        if (!clipJson.is_object() || !clipJson.contains("frames") || !clipJson["frames"].is_array()) {
+            spdlog::warn("PROTOTYPECACHE::compile::原型 '{}' 的动画 '{}' 缺少 'frames' 数组", key, clipName);
+            return;
+        }
+        float duration = static_cast<float>(clipJson.value("duration", 100)) / 1000.0f; // 毫秒转换为秒
+        int row = clipJson.value("row", 0);
+        auto animation = std::make_unique<engine::render::Animation>(clipName, clipJson.value("loop", !isEffect));
+        for (const auto &frame : clipJson["frames"]) {
+            if (!frame.is_number_integer()) continue;
+            int column = frame.get<int>();
+            animation->addFrame({origin.x + column * frameSize.x, origin.y + row * frameSize.y, frameSize.x, frameSize.y}, duration);
+        }
+        clips->emplace(std::string(clipName), std::move(animation));
+    };
+    if (data.contains("animation")) {
+        const auto &animationJson = data["animation"];
+        if (animationJson.contains("frames")) {
+            addClip("default", animationJson);
+        } else {
+            for (const auto &[clipName, clipJson] : animationJson.items()) {
+                addClip(clipName, clipJson);
+            }
+        }
+    }
+    if (!clips->empty()) {
+        auto it = clips->find("idle");
+        if (it == clips->end()) it = clips->begin();
+        prototype->initialAnimation = it->second.get();
+        prototype->clips = std::move(clips);
+        prototype->isOneShotRemoval = isEffect;
+    }
+
+    SDL_FRect sourceRect = {origin.x, origin.y, frameSize.x, frameSize.y};
+    if (prototype->initialAnimation && !prototype->initialAnimation->isEmpty()) {
+        sourceRect = prototype->initialAnimation->getFrame(0.0f).sourceRect;
+    }
+    prototype->sprite.sprite = engine::render::Sprite(textureID, sourceRect);
+    prototype->sprite.size = frameSize;
+    prototype->sprite.offset = {data.value("offset_x", 0.0f), data.value("offset_y", 0.0f)};
+    return prototype;
+}
+
+} // namespace engine::ecs
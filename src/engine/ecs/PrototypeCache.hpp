@@ -0,0 +1,105 @@
+#pragma once
+#include "Components.hpp"
+
+#include <entt/core/fwd.hpp>
+#include <glm/vec2.hpp>
+#include <nlohmann/json_fwd.hpp>
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace engine::resource {
+class ResourceManager;
+}
+
+namespace engine::ecs {
+
+/**
+ * @brief 编译好的实体原型 (只读)
+ *
+ * 数据文件 (enemy_data.json 等) 中的一个条目在启动时解析一次：属性、精灵 (已算好源矩形、尺寸与偏移)、
+ * 共享的动画集合都在这里，生成实体时 (EntityFactory::spawn) 只是复制，不再访问 JSON 或重新构建动画帧。
+ */
+struct Prototype {
+    std::string key;  ///< @brief 数据文件中的键 (例如 "slime")
+    std::string name; ///< @brief 显示名称 (数据中没有时为键)
+
+    /// @name 通用战斗属性 (数据中没有的字段为 0)
+    /// @{
+    int hp = 0;
+    int attack = 0;
+    int defense = 0;
+    float range = 0.0f;
+    float attackInterval = 0.0f;
+    float speed = 0.0f;
+    /// @}
+    std::unordered_map<entt::id_type, float> stats;            ///< @brief 所有数值 / 布尔字段 (布尔为 0 / 1)，键为字段名的哈希
+    std::unordered_map<entt::id_type, std::string> properties; ///< @brief 其余字符串字段 (type、skill、projectile 等)
+    std::unordered_map<entt::id_type, std::string> sounds;     ///< @brief 事件名哈希 -> 音效ID
+
+    Sprite sprite;                                               ///< @brief 精灵模板 (源矩形为初始动画的第一帧)
+    glm::vec2 scale = {1.0f, 1.0f};                              ///< @brief 显示尺寸 (size_x / size_y) 与帧尺寸之比
+    bool isFacingRight = true;                                   ///< @brief 精灵图中的朝向
+    std::shared_ptr<const AnimationClips> clips;                 ///< @brief 预先构建的动画 (同一原型的所有实体共享)，没有动画时为空
+    const engine::render::Animation *initialAnimation = nullptr; ///< @brief 生成时播放的动画 ("idle"，没有时为任意一个)
+    bool isOneShotRemoval = false;                               ///< @brief 初始动画播放完后是否删除实体 (特效)
+
+    /// @brief 获取数值字段，不存在时返回 fallback
+    float getStat(entt::id_type id, float fallback = 0.0f) const;
+    /// @brief 获取字符串字段，不存在时返回空
+    std::string_view getProperty(entt::id_type id) const;
+};
+
+/**
+ * @brief 实体原型缓存
+ *
+ * 按 "类别 (数据文件) + 键" 保存编译好的原型，查找为两次哈希表访问。
+ * 应在启动时 (或场景的 prepare 中) 加载，之后只读，可以被多个线程同时查找。
+ */
+class PrototypeCache final {
+  private:
+    using Category = std::unordered_map<entt::id_type, std::unique_ptr<const Prototype>>;
+
+    engine::resource::ResourceManager &m_resourceManager;     ///< @brief 用于预加载纹理并查询尺寸
+    std::unordered_map<entt::id_type, Category> m_categories; ///< @brief 类别哈希 -> (键哈希 -> 原型)
+
+  public:
+    explicit PrototypeCache(engine::resource::ResourceManager &resourceManager);
+    ~PrototypeCache();
+
+    PrototypeCache(const PrototypeCache &) = delete;
+    PrototypeCache &operator=(const PrototypeCache &) = delete;
+    PrototypeCache(PrototypeCache &&) = delete;
+    PrototypeCache &operator=(PrototypeCache &&) = delete;
+
+    /**
+     * @brief 编译数据文件中的所有条目
+     * @param category 类别名称 (例如 "enemy")，同一类别重复加载时覆盖同名原型
+     * @param path JSON 数据文件路径
+     * @return 是否加载成功
+     */
+    [[nodiscard]] bool loadFile(std::string_view category, std::string_view path);
+
+    /**
+     * @brief 查找原型
+     * @param category 类别哈希 (例如 "enemy"_hs)
+     * @param key 键哈希 (例如 "slime"_hs)
+     * @return 原型指针，不存在时返回 nullptr
+     */
+    const Prototype *get(entt::id_type category, entt::id_type key) const;
+    const Prototype *get(std::string_view category, std::string_view key) const; ///< @brief 按字符串查找原型
+
+    size_t getPrototypeCount() const; ///< @brief 获取所有类别的原型总数
+    void clear();                     ///< @brief 清空所有原型
+
+  private:
+    /**
+     * @brief 把 JSON 条目编译为原型
+     * @param isEffect 是否为特效：动画没有写 loop 字段时只播放一次，播放完后删除实体
+     */
+    std::unique_ptr<Prototype> compile(std::string_view key, const nlohmann::json &data, bool isEffect);
+};
+
+} // namespace engine::ecs
@@ -0,0 +1,184 @@
+#include "Systems.hpp"
+#include "../core/Context.hpp"
+#include "../core/JobSystem.hpp"
+#include "../debug/Trace.hpp"
+#include "../render/Animation.hpp"
+#include "../render/Camera.hpp"
+#include "../render/Renderer.hpp"
+
+#include <entt/entity/registry.hpp>
+#include <glm/common.hpp>
+#include <spdlog/spdlog.h>
+
+#include <mutex>
+#include <vector>
+
+namespace engine::ecs {
+
+namespace {
+constexpr size_t PARALLEL_CHUNK_SIZE = 256; // 并行系统每个任务处理的实体数 (纯数据更新很轻，块比 GameObject 的大)
+
+/// @brief 推进单个实体的动画，返回是否需要删除该实体 (一次性动画播放完毕)
+bool stepAnimation(Animator &animator, Sprite *sprite, const glm::vec2 &scale, float deltaTime) {
+    if (!animator.isPlaying || !animator.current || !sprite || animator.current->isEmpty()) return false;
+    animator.timer += deltaTime;
+    setSpriteSourceRect(*sprite, animator.current->getFrame(animator.timer).sourceRect, scale);
+    // 检查非循环动画是否已结束
+    if (!animator.current->isLooping() && animator.timer >= animator.current->getTotalDuration()) {
+        animator.isPlaying = false;
+        animator.timer = animator.current->getTotalDuration(); // 将时间限制在结束点
+        return animator.isOneShotRemoval;
+    }
+    return false;
+}
+
+void stepHealth(Health &health, float deltaTime) {
+    if (!health.isInvincible) return;
+    health.invincibilityTimer -= deltaTime;
+    if (health.invincibilityTimer <= 0.0f) {
+        health.isInvincible = false;
+        health.invincibilityTimer = 0.0f;
+    }
+}
+} // namespace
+
+void savePreviousPositions(entt::registry &registry) {
+    ENGINE_TRACE_ZONE("ecs::savePreviousPositions");
+    for (auto [entity, transform] : registry.view<Transform>().each()) {
+        transform.previousPosition = transform.position;
+    }
+}
+
+void updateAnimations(entt::registry &registry, float deltaTime, engine::core::JobSystem *jobSystem) {
+    ENGINE_TRACE_ZONE("ecs::updateAnimations");
+    // 并行阶段不能增删组件，需要删除的实体先收集起来
+    std::vector<entt::entity> finished;
+    if (jobSystem) {
+        // 按 Animator 的紧凑数组分块；其余组件的存储在并行前取好，任务中只做查找不做创建
+        auto &animators = registry.storage<Animator>();
+        auto &sprites = registry.storage<Sprite>();
+        auto &transforms = registry.storage<Transform>();
+        std::mutex finishedMutex;
+        jobSystem->parallelFor(animators.size(), PARALLEL_CHUNK_SIZE, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                auto entity = animators.data()[i];
+                auto *sprite = sprites.contains(entity) ? &sprites.get(entity) : nullptr;
+                glm::vec2 scale = transforms.contains(entity) ? transforms.get(entity).scale : glm::vec2{1.0f, 1.0f};
+                if (stepAnimation(animators.get(entity), sprite, scale, deltaTime)) {
+                    std::lock_guard lock(finishedMutex);
+                    finished.push_back(entity);
+                }
+            }
+        });
+    } else {
+        auto view = registry.view<Animator, Sprite>();
+        for (auto [entity, animator, sprite] : view.each()) {
+            const auto *transform = registry.try_get<Transform>(entity);
+            if (stepAnimation(animator, &sprite, transform ? transform->scale : glm::vec2{1.0f, 1.0f}, deltaTime)) {
+                finished.push_back(entity);
+            }
+        }
+    }
+    for (auto entity : finished) {
+        registry.emplace_or_replace<NeedRemove>(entity);
+    }
+}
+
+void updateHealth(entt::registry &registry, float deltaTime, engine::core::JobSystem *jobSystem) {
+    ENGINE_TRACE_ZONE("ecs::updateHealth");
+    auto &healths = registry.storage<Health>();
+    if (jobSystem) {
+        jobSystem->parallelFor(healths.size(), PARALLEL_CHUNK_SIZE, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                stepHealth(healths.get(healths.data()[i]), deltaTime);
+            }
+        });
+    } else {
+        for (auto &health : healths) {
+            stepHealth(health, deltaTime);
+        }
+    }
+}
+
+void destroyMarkedEntities(entt::registry &registry) {
+    ENGINE_TRACE_ZONE("ecs::destroyMarkedEntities");
+    auto view = registry.view<NeedRemove>();
+    registry.destroy(view.begin(), view.end());
+}
+
+void renderTileLayers(entt::registry &registry, engine::core::Context &context) {
+    ENGINE_TRACE_ZONE("ecs::renderTileLayers");
+    auto &renderer = context.getRenderer();
+    const auto &camera = context.getCamera();
+    for (auto [entity, layer] : registry.view<TileLayer>().each()) {
+        if (layer.isHidden || layer.tileSize.x <= 0 || layer.tileSize.y <= 0) continue;
+        engine::component::drawTiles(renderer, camera, layer.tiles, layer.tileSize, layer.mapSize, layer.offset, layer.maxOverhang, layer.layer);
+    }
+}
+
+void renderSprites(entt::registry &registry, engine::core::Context &context) {
+    ENGINE_TRACE_ZONE("ecs::renderSprites");
+    auto &renderer = context.getRenderer();
+    const auto &camera = context.getCamera();
+    float alpha = renderer.getInterpolationAlpha();
+    for (auto [entity, transform, sprite] : registry.view<Transform, Sprite>().each()) {
+        if (sprite.isHidden) continue;
+        renderer.drawSprite(camera, sprite.sprite, transform.getInterpolatedPosition(alpha) + sprite.offset, transform.scale, transform.rotation, sprite.layer);
+    }
+}
+
+void playAnimation(Animator &animator, Sprite *sprite, std::string_view name, const glm::vec2 &scale) {
+    const engine::render::Animation *animation = nullptr;
+    if (animator.clips) {
+        if (auto it = animator.clips->find(std::string(name)); it != animator.clips->end()) {
+            animation = it->second.get();
+        }
+    }
+    if (!animation) {
+        spdlog::warn("ECS::playAnimation::未找到动画 '{}'", name);
+        return;
+    }
+    if (animator.current == animation && animator.isPlaying) return; // 已经在播放相同的动画，不重新开始
+
+    animator.current = animation;
+    animator.timer = 0.0f;
+    animator.isPlaying = true;
+    // 立即将精灵更新到第一帧
+    if (sprite && !animation->isEmpty()) {
+        setSpriteSourceRect(*sprite, animation->getFrame(0.0f).sourceRect, scale);
+    }
+}
+
+void setSpriteSourceRect(Sprite &sprite, const SDL_FRect &sourceRect, const glm::vec2 &scale) {
+    sprite.sprite.setSourceRect(sourceRect);
+    glm::vec2 size = {sourceRect.w, sourceRect.h};
+    if (size == sprite.size) return; // 同一动画的帧通常尺寸一致，无需重新计算偏移
+    sprite.size = size;
+    if (sprite.alignment != engine::utils::Alignment::NONE) {
+        sprite.offset = engine::utils::getAlignmentOffset(sprite.alignment, size * scale);
+    }
+}
+
+bool takeDamage(Health &health, int damageAmount) {
+    if (damageAmount <= 0 || !health.isAlive()) return false; // 不造成伤害或已经死亡
+    if (health.isInvincible) return false;                    // 无敌状态，不受伤
+    health.currentHealth = glm::max(0, health.currentHealth - damageAmount);
+    // 如果受伤但没死，并且设置了无敌时间，则触发无敌
+    if (health.isAlive() && health.invincibilityDuration > 0.0f) {
+        setInvincible(health, health.invincibilityDuration);
+    }
+    return true;
+}
+
+int heal(Health &health, int healAmount) {
+    if (healAmount <= 0 || !health.isAlive()) return health.currentHealth; // 不治疗或已经死亡
+    health.currentHealth = glm::min(health.maxHealth, health.currentHealth + healAmount);
+    return health.currentHealth;
+}
+
+void setInvincible(Health &health, float duration) {
+    health.isInvincible = duration > 0.0f;
+    health.invincibilityTimer = health.isInvincible ? duration : 0.0f;
+}
+
+} // namespace engine::ecs
@@ -0,0 +1,57 @@
+#pragma once
+#include "Components.hpp"
+
+#include <entt/entity/fwd.hpp>
+
+#include <string_view>
+
+namespace engine::core {
+class Context;
+class JobSystem;
+} // namespace engine::core
+
+/**
+ * @brief ECS 系统函数
+ *
+ * 每个系统通过 view 顺序遍历一种或几种组件的紧凑数组，不经过虚函数，也不按对象跳转内存。
+ * Scene::update 中的执行顺序: savePreviousPositions -> updateAnimations -> updateHealth -> destroyMarkedEntities；
+ * Scene::render 中: renderTileLayers -> renderSprites。
+ */
+namespace engine::ecs {
+
+/// @brief 记录所有 Transform 的当前位置作为插值起点 (每次模拟更新前调用)
+void savePreviousPositions(entt::registry &registry);
+
+/**
+ * @brief 推进动画计时器并更新精灵的源矩形
+ * @param registry 实体所在的 registry
+ * @param deltaTime 时间步长
+ * @param jobSystem 不为空时分块并行执行 (一次性动画结束后的删除标记在并行阶段结束后统一添加)
+ */
+void updateAnimations(entt::registry &registry, float deltaTime, engine::core::JobSystem *jobSystem = nullptr);
+/// @brief 更新无敌计时器，jobSystem 不为空时分块并行执行
+void updateHealth(entt::registry &registry, float deltaTime, engine::core::JobSystem *jobSystem = nullptr);
+/// @brief 销毁所有带 NeedRemove 标记的实体
+void destroyMarkedEntities(entt::registry &registry);
+
+void renderTileLayers(entt::registry &registry, engine::core::Context &context); ///< @brief 录制所有可见瓦片层的绘制命令
+void renderSprites(entt::registry &registry, engine::core::Context &context);    ///< @brief 录制所有可见精灵的绘制命令 (使用插值位置)
+
+/// @name 组件操作 (与 AnimationComponent / HealthComponent 的同名方法行为一致)
+/// @{
+/**
+ * @brief 播放指定名称的动画，并立即把精灵更新到第一帧
+ * @param animator 动画状态
+ * @param sprite 同一实体上的精灵，可为空
+ * @param name 动画名称
+ * @param scale 实体的缩放，用于重新计算对齐偏移
+ */
+void playAnimation(Animator &animator, Sprite *sprite, std::string_view name, const glm::vec2 &scale = {1.0f, 1.0f});
+/// @brief 设置精灵的源矩形，尺寸变化时重新计算对齐偏移
+void setSpriteSourceRect(Sprite &sprite, const SDL_FRect &sourceRect, const glm::vec2 &scale);
+bool takeDamage(Health &health, int damageAmount);  ///< @brief 施加伤害，无敌或已死亡时无效，成功时触发无敌帧
+int heal(Health &health, int healAmount);           ///< @brief 治疗（不超过最大生命值），返回治疗后生命值
+void setInvincible(Health &health, float duration); ///< @brief 进入无敌状态，duration <= 0 时取消无敌
+/// @}
+
+} // namespace engine::ecs
@@ -44,6 +44,7 @@ void InputManager::update() {
     // 2. 处理所有待处理的 SDL 事件 (这将设定 m_actionStates 的值)
     SDL_Event event;
     while (SDL_PollEvent(&event)) {
+        if (ImGui::GetCurrentContext()) ImGui_ImplSDL3_ProcessEvent(&event); // 调试叠加层需要同样的事件
         processEvent(event);
     }
     // 3. 触发回调
@@ -150,6 +151,22 @@ void InputManager::initializeMappings(const engine::core::Config *config) {
         spdlog::debug("INPUTMANAGER::initializeMappings::配置中没有定义 'mouse_right' 动作,添加默认映射到 'MouseRight'.");
         actionsToKeyname["mouse_right"] = {"MouseRight"}; // 如果缺失则添加默认映射
     }
+    if (actionsToKeyname.find("toggle_profiler") == actionsToKeyname.end()) {
+        spdlog::debug("INPUTMANAGER::initializeMappings::配置中没有定义 'toggle_profiler' 动作,添加默认映射到 'F3'.");
+        actionsToKeyname["toggle_profiler"] = {"F3"}; // 帧分析器叠加层开关
+    }
+    if (actionsToKeyname.find("dump_trace") == actionsToKeyname.end()) {
+        spdlog::debug("INPUTMANAGER::initializeMappings::配置中没有定义 'dump_trace' 动作,添加默认映射到 'F4'.");
+        actionsToKeyname["dump_trace"] = {"F4"}; // 导出 Chrome 追踪文件
+    }
+    if (actionsToKeyname.find("cycle_game_speed") == actionsToKeyname.end()) {
+        spdlog::debug("INPUTMANAGER::initializeMappings::配置中没有定义 'cycle_game_speed' 动作,添加默认映射到 'F5'.");
+        actionsToKeyname["cycle_game_speed"] = {"F5"}; // 循环切换游戏速度 1x/2x/4x/最大
+    }
+    if (actionsToKeyname.find("dump_frame_report") == actionsToKeyname.end()) {
+        spdlog::debug("INPUTMANAGER::initializeMappings::配置中没有定义 'dump_frame_report' 动作,添加默认映射到 'F6'.");
+        actionsToKeyname["dump_frame_report"] = {"F6"}; // 导出帧时间报告
+    }
 
     // 遍历 动作 -> 按键名称 的映射
     for (const auto &[actionName, keyNames] : actionsToKeyname) {
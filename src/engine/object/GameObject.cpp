@@ -1,7 +1,9 @@
 #include "GameObject.hpp"
+#include "../component/TransformComponent.hpp"
 #include "../input/InputManager.hpp"
 #include "../render/Camera.hpp"
 #include "../render/Renderer.hpp"
+#include "../scene/Scene.hpp"
 
 namespace engine::object {
 
@@ -12,32 +14,88 @@ GameObject::GameObject(std::string_view name, std::string_view tag) : m_name(nam
 /// @name 生命周期
 /// @{
 void GameObject::update(float deltaTime, engine::core::Context &context) {
-    // 遍历所有组件并调用它们的 update 方法
-    for (auto &pair : m_components) {
-        pair.second->update(deltaTime, context);
+    // 先记录本次模拟前的位置，供渲染插值使用 (必须在任何组件修改位置之前)
+    if (auto *transform = getComponent<engine::component::TransformComponent>()) {
+        transform->savePreviousPosition();
+    }
+    // 按组件ID顺序调用所有组件的 update 方法
+    for (auto &component : m_components) {
+        if (component) component->update(deltaTime, context);
+    }
+}
+
+void GameObject::updateParallel(float deltaTime, engine::core::Context &context) {
+    if (auto *transform = getComponent<engine::component::TransformComponent>()) {
+        transform->savePreviousPosition();
+    }
+    for (auto &component : m_components) {
+        if (component && component->isThreadSafeUpdate()) {
+            component->update(deltaTime, context);
+        }
+    }
+}
+
+void GameObject::updateSerial(float deltaTime, engine::core::Context &context) {
+    for (auto &component : m_components) {
+        if (component && !component->isThreadSafeUpdate()) {
+            component->update(deltaTime, context);
+        }
     }
 }
 
 void GameObject::render(engine::core::Context &context) {
-    // 遍历所有组件并调用它们的 render 方法
-    for (auto &pair : m_components) {
-        pair.second->render(context);
+    // 按组件ID顺序调用所有组件的 render 方法
+    for (auto &component : m_components) {
+        if (component) component->render(context);
     }
 }
 
 void GameObject::clean() {
     spdlog::trace("GAMEOBJECT::clean::清空 GameObject... {} {}", m_name, m_tag);
     // 遍历所有组件并调用它们的 clean 方法
-    for (auto &pair : m_components) {
-        pair.second->clean();
+    for (auto &component : m_components) {
+        if (component) component->clean();
+    }
+    for (auto &component : m_components) {
+        component.reset(); // unique_ptr 会自动释放内存
+    }
+}
+
+void GameObject::reset() {
+    m_needRemove = false;
+    for (auto &component : m_components) {
+        if (component) component->reset();
+    }
+}
+
+bool GameObject::needsUpdate() const {
+    for (const auto &component : m_components) {
+        if (component && component->needsUpdate()) return true;
     }
-    m_components.clear(); // 清空 map, unique_ptr 会自动释放内存
+    return false;
+}
+
+bool GameObject::needsInput() const {
+    for (const auto &component : m_components) {
+        if (component && component->needsInput()) return true;
+    }
+    return false;
+}
+
+void GameObject::notifyComponentsChanged() {
+    if (m_scene) m_scene->onComponentsChanged(*this);
+}
+
+bool GameObject::canChangeComponents(std::string_view action) const {
+    if (!m_scene || !m_scene->isInParallelPhase()) return true;
+    spdlog::error("GAMEOBJECT::{}::{} 在并行更新阶段增删组件，已忽略 (请改用 Scene::getCommandBuffer)", action, m_name);
+    return false;
 }
 
 void GameObject::handleInput(engine::core::Context &context) {
-    // 遍历所有组件并调用它们的 handleInput 方法
-    for (auto &pair : m_components) {
-        pair.second->handleInput(context);
+    // 按组件ID顺序调用所有组件的 handleInput 方法
+    for (auto &component : m_components) {
+        if (component) component->handleInput(context);
     }
 }
 /// @}
@@ -1,31 +1,51 @@
 #pragma once
 #include "../component/Component.hpp"
+#include "../utils/PoolAllocator.hpp"
+#include "ObjectArena.hpp"
+#include "ObjectHandle.hpp"
 
+#include <entt/core/fwd.hpp>
 #include <spdlog/spdlog.h>
 
+#include <array>
+#include <concepts>
 #include <memory>
 #include <string>
-#include <typeindex>
-#include <unordered_map>
+#include <type_traits>
 #include <utility>
 
 namespace engine::core {
 class Context;
 } // namespace engine::core
 
+namespace engine::scene {
+class Scene;
+} // namespace engine::scene
+
 namespace engine::object {
 
+/// @brief 可以挂载到 GameObject 上的组件类型：继承自 Component 并声明了编译期组件ID
+template <typename T>
+concept ComponentClass = std::is_base_of_v<engine::component::Component, T> && requires {
+    { T::TYPE } -> std::convertible_to<engine::component::ComponentType>;
+};
+
 /**
  * @brief 游戏对象类，用于管理游戏中的实体对象
  * 该类使用组件模式管理功能，支持添加、获取、移除组件
+ * 组件按编译期组件ID存放在定长数组中，查找为 O(1) 下标访问，遍历顺序即 ComponentType 中声明的顺序
  */
 class GameObject final {
   private:
-    bool m_needRemove = false; ///< @brief 延迟删除的标识，将来由场景类负责删除
-    std::string m_name;        /// @brief 对象名称
-    std::string m_tag;         /// @brief 对象标签
+    bool m_needRemove = false;               ///< @brief 延迟删除的标识，将来由场景类负责删除
+    std::string m_name;                      /// @brief 对象名称
+    std::string m_tag;                       /// @brief 对象标签
+    ObjectArena *m_arena = nullptr;          ///< @brief 组件的内存池 (由 Scene::createGameObject 设置)，为空时组件直接 new
+    ObjectHandle m_handle;                   ///< @brief 所在场景分配的句柄，未加入场景时为空
+    engine::scene::Scene *m_scene = nullptr; ///< @brief 所在场景 (增删组件时通知其更新活跃列表)，未加入场景时为空
+    entt::id_type m_poolKey = 0;             ///< @brief 对象池键 (哈希)，非 0 时被移除的对象回收到场景的对象池而不是析构
 
-    std::unordered_map<std::type_index, std::unique_ptr<component::Component>> m_components; ///< @brief 组件列表
+    std::array<std::unique_ptr<component::Component>, component::COMPONENT_TYPE_COUNT> m_components; ///< @brief 组件表，下标为组件ID (空指针表示没有该组件)
 
   public:
     /**
@@ -40,40 +60,51 @@ class GameObject final {
     GameObject(GameObject &&) = delete;
     GameObject &operator=(GameObject &&) = delete;
 
+    /// @brief 对象可能来自场景的对象内存池，也可能直接 new，统一由 PoolAllocator 根据块头释放
+    static void *operator new(std::size_t size) { return engine::utils::PoolAllocator::allocateUnpooled(size); }
+    static void operator delete(void *ptr) { engine::utils::PoolAllocator::deallocate(ptr); }
+
+    /// @brief 设置名称 (已加入场景的对象请用 Scene::setGameObjectName，否则按名称查找不到它)
     void setName(std::string_view name) { m_name = name; }
+    /// @brief 设置标签 (已加入场景的对象请用 Scene::setGameObjectTag，否则标签分组不会更新)
     void setTag(std::string_view tag) { m_tag = tag; }
     void setNeedRemove(bool needRemove) { m_needRemove = needRemove; }
     std::string_view getName() const { return m_name; }
     std::string_view getTag() const { return m_tag; }
     bool isNeedRemove() const { return m_needRemove; }
+    void setArena(ObjectArena *arena) { m_arena = arena; }          ///< @brief 设置组件的内存池 (应在添加组件之前调用)
+    void setHandle(ObjectHandle handle) { m_handle = handle; }      ///< @brief 设置句柄 (由 Scene 在添加 / 移除对象时调用)
+    ObjectHandle getHandle() const { return m_handle; }             ///< @brief 获取句柄，可跨帧保存并通过 Scene::getGameObject 解析
+    void setScene(engine::scene::Scene *scene) { m_scene = scene; } ///< @brief 设置所在场景 (由 Scene 在添加 / 移除对象时调用)
+    engine::scene::Scene *getScene() const { return m_scene; }      ///< @brief 获取所在场景，未加入场景时为空
+    void setPoolKey(entt::id_type poolKey) { m_poolKey = poolKey; } ///< @brief 设置对象池键 (创建可回收对象时设置，例如 "arrow"_hs)
+    entt::id_type getPoolKey() const { return m_poolKey; }          ///< @brief 获取对象池键，0 表示不回收
+    bool needsUpdate() const;                                       ///< @brief 是否有组件需要每帧 update
+    bool needsInput() const;                                        ///< @brief 是否有组件需要处理输入
 
     /**
      * @brief 添加组件 (里面会完成组件的init())
      * @tparam T 组件类型
      * @tparam Args 组件构造函数参数类型
      * @param args 组件构造函数参数
-     * @return 组件指针
+     * @return 组件指针；在并行更新阶段添加新组件时返回 nullptr (请改用 Scene::getCommandBuffer)
      */
-    template <typename T, typename... Args>
+    template <ComponentClass T, typename... Args>
     inline T *addComponent(Args &&...args) {
-        // 检测组件是否合法。
-        /* static_assert(condition, message)：静态断言，在编译期检测，无任何性能影响 */
-        /* std::is_base_of<Base, Derived>::value -- 判断 Base 类型是否是 Derived 类型的基类 */
-        static_assert(std::is_base_of<engine::component::Component, T>::value, "GAMEOBJECT::addComponent::ERROR::T 必须继承自 Component");
-        // 获取类型标识。
-        /* typeid(T) -- 用于获取一个表达式或类型的运行时类型信息 (RTTI), 返回 std::type_info& */
-        /* std::type_index -- 针对std::type_info对象的包装器，主要设计用来作为关联容器（如 std::map）的键。*/
-        auto typeIndex = std::type_index(typeid(T));
+        auto &slot = m_components[indexOf<T>()];
         // 如果组件已经存在，则直接返回组件指针
-        if (hasComponent<T>()) {
-            return getComponent<T>();
+        if (slot) {
+            return static_cast<T *>(slot.get());
         }
-        // 如果不存在则创建组件     /* std::forward -- 用于实现完美转发。传递多个参数的时候使用...标识 */
-        auto newComponent = std::make_unique<T>(std::forward<Args>(args)...);
-        T *ptr = newComponent.get();                       // 先获取裸指针以便返回
-        newComponent->setOwner(this);                      // 设置组件的拥有者
-        m_components[typeIndex] = std::move(newComponent); // 移动组件   （newComponent 变为空，不可再使用）
-        ptr->init();                                       // 初始化组件 （因此必须用ptr而不能用newComponent）
+        if (!canChangeComponents("addComponent")) return nullptr;
+        // 如果不存在则创建组件 (有内存池时从池中分配)     /* std::forward -- 用于实现完美转发。传递多个参数的时候使用...标识 */
+        auto newComponent = m_arena ? std::unique_ptr<T>(m_arena->create<T>(std::forward<Args>(args)...))
+                                    : std::make_unique<T>(std::forward<Args>(args)...);
+        T *ptr = newComponent.get(); // 先获取裸指针以便返回
+        newComponent->setOwner(this); // 设置组件的拥有者
+        slot = std::move(newComponent); // 移动组件   （newComponent 变为空，不可再使用）
+        ptr->init();                    // 初始化组件 （因此必须用ptr而不能用newComponent）
+        notifyComponentsChanged();
         spdlog::debug("GAMEOBJECT::addComponent::{} 添加组件 {}", m_name, typeid(T).name());
         return ptr;
     }
@@ -82,46 +113,55 @@ class GameObject final {
      * @tparam T 组件类型
      * @return 组件指针
      */
-    template <typename T>
+    template <ComponentClass T>
     T *getComponent() const {
-        static_assert(std::is_base_of<engine::component::Component, T>::value, "GAMEOBJECT::getComponent::ERROR::T 必须继承自 Component");
-        auto typeIndex = std::type_index(typeid(T));
-        auto it = m_components.find(typeIndex);
-        if (it != m_components.end()) {
-            // 返回unique_ptr的裸指针。(肯定是T类型, static_cast其实并无必要，但保留可以使我们意图更清晰)
-            return static_cast<T *>(it->second.get());
-        }
-        return nullptr;
+        // 每个下标只会存放对应类型的组件，static_cast 是安全的
+        return static_cast<T *>(m_components[indexOf<T>()].get());
     }
     /**
      * @brief 检查是否存在组件
      * @tparam T 组件类型
      * @return 是否存在组件
      */
-    template <typename T>
+    template <ComponentClass T>
     bool hasComponent() const {
-        static_assert(std::is_base_of<engine::component::Component, T>::value, "GAMEOBJECT::hasComponent::ERROR::T 必须继承自 Component");
-        return m_components.contains(std::type_index(typeid(T))); // contains方法为 C++20 新增
+        return m_components[indexOf<T>()] != nullptr;
     }
     /**
-     * @brief 移除组件
+     * @brief 移除组件 (并行更新阶段调用时不做修改，请改用 Scene::getCommandBuffer)
      * @tparam T 组件类型
      */
-    template <typename T>
+    template <ComponentClass T>
     void removeComponent() {
-        static_assert(std::is_base_of<engine::component::Component, T>::value, "GAMEOBJECT::removeComponent::ERROR::T 必须继承自 Component");
-        auto typeIndex = std::type_index(typeid(T));
-        auto it = m_components.find(typeIndex);
-        if (it != m_components.end()) {
-            it->second->clean();
-            m_components.erase(it);
+        auto &slot = m_components[indexOf<T>()];
+        if (slot && canChangeComponents("removeComponent")) {
+            slot->clean();
+            slot.reset();
+            notifyComponentsChanged();
         }
     }
 
     void handleInput(engine::core::Context &context);             /// @brief 处理输入
     void update(float deltaTime, engine::core::Context &context); /// @brief 更新游戏对象
+    /// @brief 并行阶段：记录插值起点并更新线程安全的组件 (只修改自身状态，可在工作线程中调用)
+    void updateParallel(float deltaTime, engine::core::Context &context);
+    /// @brief 同步阶段：更新其余组件 (必须在主线程、并行阶段结束后调用)
+    void updateSerial(float deltaTime, engine::core::Context &context);
     void render(engine::core::Context &context);                  /// @brief 渲染游戏对象
     void clean();                                                 /// @brief 清理游戏对象
+    void reset();                                                 /// @brief 回收到对象池时重置删除标记和所有组件 (保留组件本身)
+
+  private:
+    void notifyComponentsChanged(); ///< @brief 组件增删后通知所在场景重新判断对象是否活跃
+    /// @brief 所在场景不处于并行更新阶段时才能增删组件 (组件表、内存池和场景的活跃列表都不是线程安全的)，否则记录错误
+    bool canChangeComponents(std::string_view action) const;
+
+    /// @brief 组件类型在组件表中的下标 (编译期常量)
+    template <ComponentClass T>
+    static constexpr size_t indexOf() {
+        static_assert(T::TYPE != engine::component::ComponentType::Count, "GAMEOBJECT::indexOf::ERROR::Count 不是有效的组件ID");
+        return static_cast<size_t>(T::TYPE);
+    }
 };
 
 } // namespace engine::object
@@ -0,0 +1,60 @@
+#pragma once
+#include "ObjectHandle.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace engine::object {
+
+/**
+ * @brief 代际句柄的槽位表
+ *
+ * acquire 优先复用空闲槽位；release 把槽位重置为默认值并使其代数加一，之前发出的句柄从此无法匹配。
+ * Slot 需要有初值非 0 的 std::uint32_t generation 成员 (默认构造的句柄代数为 0，永远无法匹配)，
+ * 其余字段由使用者维护。
+ */
+template <typename Slot>
+class HandleTable final {
+  private:
+    std::vector<Slot> m_slots;              ///< @brief 槽位 (索引即 ObjectHandle::index)
+    std::vector<std::uint32_t> m_freeSlots; ///< @brief 空闲槽位索引
+
+  public:
+    /// @brief 分配一个槽位，返回指向它的句柄
+    ObjectHandle acquire() {
+        std::uint32_t index;
+        if (!m_freeSlots.empty()) {
+            index = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        } else {
+            index = static_cast<std::uint32_t>(m_slots.size());
+            m_slots.emplace_back();
+        }
+        return {index, m_slots[index].generation};
+    }
+    /**
+     * @brief 释放句柄指向的槽位
+     * @return 句柄已失效 (槽位已被释放或不属于本表) 时返回 false
+     */
+    bool release(ObjectHandle handle) {
+        if (!isValid(handle)) return false;
+        auto &slot = m_slots[handle.index];
+        std::uint32_t generation = slot.generation + 1;
+        slot = Slot{};
+        slot.generation = generation;
+        m_freeSlots.push_back(handle.index);
+        return true;
+    }
+
+    /// @brief 句柄是否仍指向一个已分配的槽位
+    bool isValid(ObjectHandle handle) const { return handle.index < m_slots.size() && m_slots[handle.index].generation == handle.generation; }
+    Slot *get(ObjectHandle handle) { return isValid(handle) ? &m_slots[handle.index] : nullptr; }             ///< @brief 解析句柄，失效时返回 nullptr
+    const Slot *get(ObjectHandle handle) const { return isValid(handle) ? &m_slots[handle.index] : nullptr; } ///< @brief 解析句柄，失效时返回 nullptr
+
+    Slot &operator[](std::uint32_t index) { return m_slots[index]; }             ///< @brief 按索引访问槽位 (不检查代数)
+    const Slot &operator[](std::uint32_t index) const { return m_slots[index]; } ///< @brief 按索引访问槽位 (不检查代数)
+    size_t size() const { return m_slots.size(); }                               ///< @brief 获取槽位数 (包括空闲槽位)
+};
+
+} // namespace engine::object
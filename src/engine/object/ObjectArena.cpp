@@ -0,0 +1,48 @@
+#include "ObjectArena.hpp"
+
+#include <spdlog/spdlog.h>
+
+namespace engine::object {
+
+ObjectArena::~ObjectArena() {
+    for (auto &pool : m_pools) {
+        utils::PoolAllocator::retire(std::move(pool));
+    }
+}
+
+void ObjectArena::release() {
+    size_t releasedBytes = 0;
+    for (auto &pool : m_pools) {
+        if (!pool) continue;
+        size_t bytes = pool->getReservedBytes();
+        if (pool->release()) {
+            releasedBytes += bytes;
+        }
+    }
+    spdlog::debug("OBJECTARENA::release::释放对象内存池 {} KB", releasedBytes / 1024);
+}
+
+void ObjectArena::reportOversized(size_t poolIndex, size_t objectSize, size_t blockObjectSize) {
+    if (m_isOversizeReported[poolIndex]) return;
+    m_isOversizeReported[poolIndex] = true;
+    spdlog::error("OBJECTARENA::create::ERROR::内存池 {} 的块只能容纳 {} 字节，对象需要 {} 字节 (派生类沿用了基类的组件ID?)，改为直接分配",
+                  poolIndex, blockObjectSize, objectSize);
+}
+
+size_t ObjectArena::getLiveCount() const {
+    size_t count = 0;
+    for (const auto &pool : m_pools) {
+        if (pool) count += pool->getLiveCount();
+    }
+    return count;
+}
+
+size_t ObjectArena::getReservedBytes() const {
+    size_t bytes = 0;
+    for (const auto &pool : m_pools) {
+        if (pool) bytes += pool->getReservedBytes();
+    }
+    return bytes;
+}
+
+} // namespace engine::object
@@ -0,0 +1,79 @@
+#pragma once
+#include "../component/Component.hpp"
+#include "../utils/PoolAllocator.hpp"
+
+#include <array>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace engine::object {
+class GameObject;
+
+/**
+ * @brief 场景持有的对象内存池集合：每种组件一个池，GameObject 一个池
+ *
+ * 由 Scene::createGameObject 创建的对象及其组件都从这里分配，释放时回到空闲链表而不是交还系统；
+ * 场景清理时所有对象析构完毕后 release() 一次性释放整块内存。
+ * 对象仍通过 std::unique_ptr (delete) 释放，由 GameObject / Component 的 operator delete 根据块头找到所属内存池。
+ */
+class ObjectArena final {
+  public:
+    static constexpr size_t GAME_OBJECT_POOL = component::COMPONENT_TYPE_COUNT; ///< @brief GameObject 池的下标 (组件池之后)
+    static constexpr size_t POOL_COUNT = GAME_OBJECT_POOL + 1;                  ///< @brief 内存池数量
+
+  private:
+    std::array<std::unique_ptr<utils::PoolAllocator>, POOL_COUNT> m_pools; ///< @brief 按组件ID索引的内存池 (首次使用时创建)
+    std::array<bool, POOL_COUNT> m_isOversizeReported{};                   ///< @brief 是否已报告过放不进该池的类型
+
+  public:
+    ObjectArena() = default;
+    ~ObjectArena();
+
+    ObjectArena(const ObjectArena &) = delete;
+    ObjectArena &operator=(const ObjectArena &) = delete;
+    ObjectArena(ObjectArena &&) = delete;
+    ObjectArena &operator=(ObjectArena &&) = delete;
+
+    /**
+     * @brief 在对应类型的内存池中构造对象
+     * @tparam T GameObject 或组件类型
+     * @param args 构造函数参数
+     * @return 对象指针 (用 delete / std::unique_ptr 释放)
+     * @note 池的块大小由第一个使用该组件ID的类型决定；沿用基类 TYPE 且更大的派生类放不进块中，改为直接从系统分配
+     */
+    template <typename T, typename... Args>
+    T *create(Args &&...args) {
+        static_assert(alignof(T) <= utils::PoolAllocator::HEADER_SIZE, "OBJECTARENA::create::ERROR::对象对齐要求超过内存池块头大小");
+        auto &pool = m_pools[poolIndexOf<T>()];
+        if (!pool) {
+            pool = std::make_unique<utils::PoolAllocator>(sizeof(T));
+        }
+        if (sizeof(T) > pool->getObjectSize()) {
+            reportOversized(poolIndexOf<T>(), sizeof(T), pool->getObjectSize());
+            return ::new (utils::PoolAllocator::allocateUnpooled(sizeof(T))) T(std::forward<Args>(args)...);
+        }
+        return ::new (pool->allocate()) T(std::forward<Args>(args)...);
+    }
+
+    /// @brief 释放所有已没有存活对象的内存池占用的内存 (场景清理时调用)
+    void release();
+    size_t getLiveCount() const;     ///< @brief 获取所有池中存活对象的总数
+    size_t getReservedBytes() const; ///< @brief 获取所有池占用的内存总量
+
+  private:
+    /// @brief 报告放不进内存池块的类型 (每个池只报告一次)
+    void reportOversized(size_t poolIndex, size_t objectSize, size_t blockObjectSize);
+
+    template <typename T>
+    static constexpr size_t poolIndexOf() {
+        if constexpr (std::is_same_v<T, GameObject>) {
+            return GAME_OBJECT_POOL;
+        } else {
+            return static_cast<size_t>(T::TYPE);
+        }
+    }
+};
+
+} // namespace engine::object
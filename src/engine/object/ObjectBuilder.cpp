@@ -13,6 +13,7 @@
 #include "../physics/PhysicsEngine.hpp"
 #include "../render/Animation.hpp"
 #include "../scene/LevelLoader.hpp"
+#include "../scene/Scene.hpp"
 
 #include <spdlog/spdlog.h>
 
@@ -105,8 +106,13 @@ void ObjectBuilder::buildBase() {
             tag = "hazard";  // 危险图块默认标签
         }
     }
-    // 创建游戏对象
-    m_gameObject = std::make_unique<GameObject>(m_name, tag.value_or(""));
+    // 创建游戏对象：从所属场景的内存池分配 (之后添加的组件也来自该场景的内存池)
+    if (m_scene) {
+        m_gameObject = m_scene->createGameObject(m_name, tag.value_or(""));
+    } else {
+        spdlog::warn("OBJECTBUILDER::buildBase::未设置所属场景，对象 '{}' 不使用场景内存池。", m_name);
+        m_gameObject = std::make_unique<GameObject>(m_name, tag.value_or(""));
+    }
 }
 
 void ObjectBuilder::buildTransform() {
@@ -9,6 +9,7 @@
 
 namespace engine::scene {
     class LevelLoader;
+    class Scene;
 }
 
 namespace engine::component {
@@ -26,6 +27,7 @@ class ObjectBuilder {
 protected:
     engine::scene::LevelLoader& m_levelLoader;
     engine::core::Context&      m_context;
+    engine::scene::Scene*       m_scene = nullptr;   ///< @brief 对象所属场景，对象及组件从它的内存池分配
     std::unique_ptr<GameObject> m_gameObject;
 
     // 解析游戏对象需要的关键信息
@@ -50,6 +52,7 @@ public:
     /// @}
 
     std::unique_ptr<GameObject> getGameObject();
+    void setScene(engine::scene::Scene* scene) { m_scene = scene; } /// @brief 设置对象所属场景 (build 之前调用)
 
 protected:
     void reset(); /// @brief 重置对象构建器
@@ -0,0 +1,23 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+
+namespace engine::object {
+
+/**
+ * @brief 游戏对象的代际句柄 (槽位索引 + 代数)
+ *
+ * 由 Scene 在添加对象时分配，通过 Scene::getGameObject 以 O(1) 解析。对象被移除后槽位的代数加一，
+ * 旧句柄随之失效 (解析结果为空)，因此可以跨帧保存目标引用，而不用担心悬空指针或线性查找。
+ */
+struct ObjectHandle {
+    static constexpr std::uint32_t INVALID_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+    std::uint32_t index = INVALID_INDEX; ///< @brief 场景槽位表中的索引
+    std::uint32_t generation = 0;        ///< @brief 分配时槽位的代数
+
+    bool isNull() const { return index == INVALID_INDEX; } ///< @brief 是否为空句柄 (从未指向任何对象)
+    friend bool operator==(const ObjectHandle &, const ObjectHandle &) = default;
+};
+
+} // namespace engine::object
@@ -1,18 +1,17 @@
 #include "Camera.hpp"
-#include "../component/TransformComponent.hpp"
 #include <spdlog/spdlog.h>
 
 namespace engine::render {
 
 Camera::Camera(const glm::vec2 &viewportSize, const glm::vec2 &position, const std::optional<engine::utils::Rect> &limitBounds)
-    : m_viewportSize(viewportSize), m_position(position), m_limitBounds(limitBounds) {
+    : m_viewportSize(viewportSize), m_position(position), m_previousPosition(position), m_renderPosition(position), m_limitBounds(limitBounds) {
     spdlog::trace("CAMERA::Camera初始化成功, 位置: {}, {}", m_position.x, m_position.y);
 }
 
-void Camera::update(float deltaTime) {
-    if (m_target == nullptr) return;
-    glm::vec2 targetPos = m_target->getPosition();
-    glm::vec2 desired_position = targetPos - m_viewportSize / 2.0f; // 计算目标位置 (让目标位于视口中心)
+void Camera::update(float deltaTime, const std::optional<glm::vec2> &targetPosition) {
+    m_previousPosition = m_position;
+    if (!targetPosition.has_value()) return;
+    glm::vec2 desired_position = targetPosition.value() - m_viewportSize / 2.0f; // 计算目标位置 (让目标位于视口中心)
 
     // 计算当前位置与目标位置的距离
     auto distance_ = glm::distance(m_position, desired_position);
@@ -34,12 +33,13 @@ void Camera::update(float deltaTime) {
 void Camera::move(const glm::vec2 &offset) {
     m_position += offset;
     clampPosition();
+    m_previousPosition = m_renderPosition = m_position; // 直接移动不做插值
 }
 
 /// @name 转换方法
 /// @{
 glm::vec2 Camera::worldToScreen(const glm::vec2 &worldPos) const {
-    return worldPos - m_position;
+    return worldPos - m_renderPosition;
 }
 
 glm::vec2 Camera::worldToScreenWithParallax(const glm::vec2 &worldPos, const glm::vec2 &scrollFactor) const {
@@ -47,7 +47,7 @@ glm::vec2 Camera::worldToScreenWithParallax(const glm::vec2 &worldPos, const glm
 }
 
 glm::vec2 Camera::screenToWorld(const glm::vec2 &screenPos) const {
-    return screenPos + m_position;
+    return screenPos + m_renderPosition;
 }
 /// @}
 
@@ -56,6 +56,7 @@ glm::vec2 Camera::screenToWorld(const glm::vec2 &screenPos) const {
 void Camera::setPosition(const glm::vec2 &position) {
     m_position = position;
     clampPosition();
+    m_previousPosition = m_renderPosition = m_position; // 直接设置位置不做插值
 }
 
 void Camera::setLimitBounds(std::optional<engine::utils::Rect> limitBounds) {
@@ -63,8 +64,19 @@ void Camera::setLimitBounds(std::optional<engine::utils::Rect> limitBounds) {
     clampPosition(); // 设置边界后，立即应用限制
 }
 
-void Camera::setTarget(engine::component::TransformComponent *target) {
+void Camera::setTarget(engine::object::ObjectHandle target, const engine::scene::Scene *scene) {
     m_target = target;
+    m_targetScene = target.isNull() ? nullptr : scene;
+}
+
+void Camera::clearTarget() {
+    m_target = {};
+    m_targetScene = nullptr;
+}
+
+void Camera::setInterpolationAlpha(float alpha) {
+    m_renderPosition = glm::mix(m_previousPosition, m_position, alpha);
+    m_renderPosition = glm::vec2(glm::round(m_renderPosition.x), glm::round(m_renderPosition.y)); // 与 update 一样取整，避免画面割裂
 }
 
 const glm::vec2 &Camera::getPosition() const {
@@ -78,7 +90,7 @@ const std::optional<engine::utils::Rect> Camera::getLimitBounds() const {
 const glm::vec2 Camera::getViewportSize() const {
     return m_viewportSize;
 }
-engine::component::TransformComponent *Camera::getTarget() const {
+engine::object::ObjectHandle Camera::getTarget() const {
     return m_target;
 }
 /// @}
@@ -4,12 +4,13 @@
  */
 
 #pragma once
+#include "../object/ObjectHandle.hpp"
 #include "../utils/Math.hpp"
 #include <optional>
 
-namespace engine::component {
-class TransformComponent;
-}
+namespace engine::scene {
+class Scene;
+} // namespace engine::scene
 
 namespace engine::render {
 /**
@@ -24,11 +25,14 @@ namespace engine::render {
  */
 class Camera final {
   private:
-    glm::vec2 m_viewportSize;                          ///< 视口大小
-    glm::vec2 m_position;                              ///< 相机在世界坐标中的位置
-    std::optional<engine::utils::Rect> m_limitBounds;  ///< 相机移动的边界限制
-    float m_smoothSpeed = 3.0f;                        ///< @brief 相机移动的平滑速度
-    component::TransformComponent *m_target = nullptr; ///< @brief 跟随目标变换组件，空值表示不跟随
+    glm::vec2 m_viewportSize;                            ///< 视口大小
+    glm::vec2 m_position;                                ///< 相机在世界坐标中的位置
+    glm::vec2 m_previousPosition;                        ///< 上一次模拟更新前的位置，用于渲染插值
+    glm::vec2 m_renderPosition;                          ///< 插值后实际用于坐标转换的位置
+    std::optional<engine::utils::Rect> m_limitBounds;    ///< 相机移动的边界限制
+    float m_smoothSpeed = 3.0f;                          ///< @brief 相机移动的平滑速度
+    engine::object::ObjectHandle m_target;               ///< @brief 跟随目标的句柄，空句柄表示不跟随
+    const engine::scene::Scene *m_targetScene = nullptr; ///< @brief 目标所在的场景，只有该场景会解析 m_target
 
   public:
     /**
@@ -44,7 +48,12 @@ class Camera final {
     Camera(Camera &&) = delete;
     Camera &operator=(Camera &&) = delete;
 
-    void update(float deltaTime);
+    /**
+     * @brief 更新相机位置
+     * @param deltaTime 时间步长
+     * @param targetPosition 跟随目标当前的位置 (由目标所在场景通过 m_target 句柄解析)，为空时不跟随
+     */
+    void update(float deltaTime, const std::optional<glm::vec2> &targetPosition = std::nullopt);
     void move(const glm::vec2 &offset);
 
     glm::vec2 worldToScreen(const glm::vec2 &worldPos) const;
@@ -53,12 +62,24 @@ class Camera final {
 
     void setPosition(const glm::vec2 &position);
     void setLimitBounds(std::optional<engine::utils::Rect> limitBounds);
-    void setTarget(engine::component::TransformComponent *target);
+    /**
+     * @brief 设置跟随目标 (目标需要 TransformComponent)
+     * @param target 目标句柄
+     * @param scene 目标所在的场景；句柄不携带场景信息，其他场景更新时不会用自己的槽位表解析它
+     */
+    void setTarget(engine::object::ObjectHandle target, const engine::scene::Scene *scene);
+    void clearTarget(); ///< @brief 取消跟随
+    /**
+     * @brief 按插值系数计算本帧渲染使用的相机位置
+     * @param alpha 渲染插值系数，范围 [0, 1]
+     */
+    void setInterpolationAlpha(float alpha);
 
     const glm::vec2 &getPosition() const;
     const std::optional<engine::utils::Rect> getLimitBounds() const;
     const glm::vec2 getViewportSize() const;
-    engine::component::TransformComponent *getTarget() const;
+    engine::object::ObjectHandle getTarget() const;
+    const engine::scene::Scene *getTargetScene() const { return m_targetScene; } ///< @brief 获取目标所在的场景
 
   private:
     void clampPosition();
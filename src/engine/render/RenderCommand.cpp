@@ -0,0 +1,139 @@
+#include "RenderCommand.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <functional>
+#include <utility>
+
+namespace engine::render {
+
+namespace {
+constexpr int PASS_SHIFT = 56;  // 渲染批次 [63, 56]
+constexpr int LAYER_SHIFT = 48; // 图层 [55, 48]
+constexpr int DEPTH_SHIFT = 16; // 深度 [47, 16]，纹理 [15, 0]
+
+/// @brief 把 float 转换为保持大小顺序的无符号整数 (负数按位取反，非负数置符号位)
+Uint32 toOrderedBits(float value) {
+    auto bits = std::bit_cast<Uint32>(value);
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+} // namespace
+
+void RenderCommandList::clear() {
+    m_commands.clear();
+    m_order.clear();
+    m_stringPool.clear();
+    m_pass = 0;
+}
+
+RenderCommand &RenderCommandList::push(RenderCommandType type, RenderLayer layer) {
+    auto &command = m_commands.emplace_back();
+    command.type = type;
+    command.sortKey = (static_cast<Uint64>(m_pass) << PASS_SHIFT) | (static_cast<Uint64>(layer) << LAYER_SHIFT);
+    return command;
+}
+
+void RenderCommandList::setDepth(RenderCommand &command, float depth, std::string_view textureID) const {
+    auto layer = static_cast<RenderLayer>((command.sortKey >> LAYER_SHIFT) & 0xFF);
+    if (!isDepthSorted(layer)) return;
+    auto texture = static_cast<Uint16>(std::hash<std::string_view>{}(textureID));
+    command.sortKey = (command.sortKey & ~((Uint64{1} << LAYER_SHIFT) - 1)) | (static_cast<Uint64>(toOrderedBits(depth)) << DEPTH_SHIFT) | texture;
+}
+
+void RenderCommandList::beginPass() {
+    if (m_pass < 0xFF) ++m_pass;
+}
+
+void RenderCommandList::sort() {
+    m_order.clear();
+    m_order.reserve(m_commands.size());
+    m_sortItems.clear();
+    // 1. 截图段提前: 每段内的命令 (不含嵌套段) 整体排序，嵌套段在结束时先输出，排在外层段之前执行 (未配对的 EndCapture 忽略)
+    m_captureItems.clear();
+    m_captureFrames.clear();
+    for (size_t i = 0; i < m_commands.size(); ++i) {
+        auto type = m_commands[i].type;
+        if (type == RenderCommandType::BeginCapture) {
+            m_captureFrames.push_back({static_cast<Uint32>(i), m_captureItems.size()});
+        } else if (type == RenderCommandType::EndCapture) {
+            if (m_captureFrames.empty()) continue;
+            flushCaptureFrame(static_cast<Uint32>(i));
+        } else if (!m_captureFrames.empty() && type != RenderCommandType::FreeCapture) {
+            m_captureItems.push_back({m_commands[i].sortKey, static_cast<Uint32>(i)});
+        }
+    }
+    while (!m_captureFrames.empty()) flushCaptureFrame(INVALID_COMMAND); // 未结束的段同样先内后外输出
+
+    // 2. 其余命令整体排序
+    int captureDepth = 0;
+    for (size_t i = 0; i < m_commands.size(); ++i) {
+        auto type = m_commands[i].type;
+        if (type == RenderCommandType::BeginCapture) {
+            ++captureDepth;
+        } else if (type == RenderCommandType::EndCapture) {
+            captureDepth = std::max(captureDepth - 1, 0);
+        } else if (captureDepth == 0 && type != RenderCommandType::FreeCapture) {
+            m_sortItems.push_back({m_commands[i].sortKey, static_cast<Uint32>(i)});
+        }
+    }
+    flushSortItems();
+
+    // 3. 释放截图放在最后，本帧仍可以使用它
+    for (size_t i = 0; i < m_commands.size(); ++i) {
+        if (m_commands[i].type == RenderCommandType::FreeCapture) m_order.push_back(static_cast<Uint32>(i));
+    }
+}
+
+void RenderCommandList::flushCaptureFrame(Uint32 endIndex) {
+    // 嵌套段已在各自结束时取走，栈顶段的命令在 m_captureItems 末尾连续存放
+    auto frame = m_captureFrames.back();
+    m_captureFrames.pop_back();
+    auto first = m_captureItems.begin() + static_cast<std::ptrdiff_t>(frame.itemOffset);
+    m_sortItems.assign(first, m_captureItems.end());
+    m_captureItems.erase(first, m_captureItems.end());
+    m_order.push_back(frame.beginIndex);
+    flushSortItems();
+    if (endIndex != INVALID_COMMAND) m_order.push_back(endIndex);
+}
+
+StringRef RenderCommandList::storeString(std::string_view str) {
+    StringRef ref{static_cast<Uint32>(m_stringPool.size()), static_cast<Uint32>(str.size())};
+    m_stringPool.append(str);
+    return ref;
+}
+
+void RenderCommandList::flushSortItems() {
+    if (m_sortItems.empty()) return;
+    m_sortScratch.resize(m_sortItems.size());
+    Uint64 firstKey = m_sortItems.front().key;
+    Uint64 differingBits = 0;
+    for (const auto &item : m_sortItems) {
+        differingBits |= item.key ^ firstKey;
+    }
+    // LSD 基数排序: 每次按一个字节做稳定的计数排序，所有键在该字节上相同时跳过 (批次、纹理等字节通常如此)
+    for (int shift = 0; shift < 64; shift += 8) {
+        if (((differingBits >> shift) & 0xFF) == 0) continue;
+        std::array<Uint32, 256> offsets{};
+        for (const auto &item : m_sortItems) {
+            ++offsets[(item.key >> shift) & 0xFF];
+        }
+        Uint32 sum = 0;
+        for (auto &offset : offsets) {
+            Uint32 bucketCount = offset;
+            offset = sum;
+            sum += bucketCount;
+        }
+        for (const auto &item : m_sortItems) {
+            m_sortScratch[offsets[(item.key >> shift) & 0xFF]++] = item;
+        }
+        m_sortItems.swap(m_sortScratch);
+    }
+    for (const auto &item : m_sortItems) {
+        m_order.push_back(item.index);
+    }
+    m_sortItems.clear();
+}
+
+} // namespace engine::render
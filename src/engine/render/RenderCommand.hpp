@@ -0,0 +1,171 @@
+#pragma once
+#include "../utils/Math.hpp"
+
+#include <SDL3/SDL_rect.h>
+#include <SDL3/SDL_stdinc.h>
+#include <glm/glm.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace engine::render {
+
+/**
+ * @enum RenderCommandType
+ * @brief 绘制命令的类型，与 Renderer / TextRenderer 的绘制接口一一对应
+ */
+enum class RenderCommandType : Uint8 {
+    Sprite,       ///< @brief 世界空间精灵 (Renderer::drawSprite / drawCaptureSprite)
+    Parallax,     ///< @brief 视差背景 (Renderer::drawParallax)
+    UISprite,     ///< @brief UI 精灵 (Renderer::drawUISprite)
+    UIFilledRect, ///< @brief UI 填充矩形 (Renderer::drawUIFilledRect)
+    UIText,       ///< @brief UI 文本 (TextRenderer::drawUIText)
+    BeginCapture, ///< @brief 之后的命令绘制到截图渲染目标 (Renderer::beginCapture)
+    EndCapture,   ///< @brief 恢复绘制到屏幕 (Renderer::endCapture)
+    DrawCapture,  ///< @brief 把截图铺满屏幕 (Renderer::drawCapture)
+    FreeCapture,  ///< @brief 销毁截图渲染目标 (Renderer::releaseCaptureTarget)
+};
+
+/**
+ * @enum RenderLayer
+ * @brief 渲染图层，决定命令提交的先后 (排序键中仅次于渲染批次)
+ *
+ * Deco 与 Units 图层内按深度 (屏幕 Y，越靠下越晚绘制) 排序，相同深度时按纹理聚集以便合批；
+ * 其他图层内保持录制顺序 (例如多个地面瓦片层按 Tiled 中的顺序叠加)。
+ */
+enum class RenderLayer : Uint8 {
+    Background,     ///< @brief 视差背景
+    Ground,         ///< @brief 地面瓦片层
+    Deco,           ///< @brief 地图装饰物 (按 Y 排序)
+    Units,          ///< @brief 单位、敌人、投射物、特效 (按 Y 排序，默认图层)
+    ForegroundTile, ///< @brief 前景瓦片 (遮挡单位)
+    UI,             ///< @brief UI (不受相机影响)
+};
+
+/// @brief 图层内是否按深度 (Y) 排序
+constexpr bool isDepthSorted(RenderLayer layer) {
+    return layer == RenderLayer::Deco || layer == RenderLayer::Units;
+}
+
+/// @brief 命令列表字符串池中的一段 (纹理ID、字体ID、文本)
+struct StringRef {
+    Uint32 offset = 0;
+    Uint32 length = 0;
+};
+
+/**
+ * @brief 一条绘制命令
+ *
+ * 录制时已经完成相机变换，position 为屏幕坐标，提交时不再访问相机或游戏对象。
+ * 字符串保存在所属 RenderCommandList 的字符串池中，命令本身不持有任何堆内存。
+ */
+struct RenderCommand {
+    RenderCommandType type = RenderCommandType::Sprite;
+    Uint64 sortKey = 0;                         ///< @brief 排序键: 渲染批次 8 位 | 图层 8 位 | 深度 32 位 | 纹理 16 位
+    bool isFlipped = false;                     ///< @brief 是否水平翻转 (Sprite / UISprite)
+    bool hasSourceRect = false;                 ///< @brief sourceRect 是否有效，否则使用整张纹理
+    bool hasSize = false;                       ///< @brief UISprite / BeginCapture 是否指定了尺寸，否则使用源矩形尺寸 / 逻辑分辨率
+    glm::bvec2 repeat = glm::bvec2(false);      ///< @brief 视差背景在两个方向上是否重复
+    int fontSize = 0;                           ///< @brief 字体大小 (UIText)
+    Uint32 targetID = 0;                        ///< @brief 截图渲染目标ID (Capture 类命令；Sprite 命令非 0 时以该截图为纹理)
+    StringRef resourceID;                       ///< @brief 纹理ID (精灵类命令) 或字体ID (UIText)
+    StringRef text;                             ///< @brief 文本内容 (UIText)
+    SDL_FRect sourceRect = {0, 0, 0, 0};        ///< @brief 源矩形
+    glm::vec2 position = {0.0f, 0.0f};          ///< @brief 屏幕坐标 (左上角)
+    glm::vec2 size = {1.0f, 1.0f};              ///< @brief Sprite / Parallax 为缩放，UISprite / UIFilledRect / BeginCapture 为尺寸
+    float angle = 0.0f;                         ///< @brief 旋转角度 (度)
+    engine::utils::FColor color = {1, 1, 1, 1}; ///< @brief 颜色 (UIFilledRect / UIText)
+};
+
+/**
+ * @brief 一帧的绘制命令列表
+ *
+ * 由模拟线程录制、主线程提交 (Renderer 中双缓冲)。clear() 只重置大小，
+ * 稳定运行后录制不会再分配内存。
+ *
+ * 录制结束时 sort() 按排序键对命令做稳定的基数排序 (O(n))，提交按 getOrder() 的顺序进行，
+ * 因此绘制顺序由图层和深度决定，而不是游戏对象在容器中的顺序。
+ *
+ * 截图段 (BeginCapture ... EndCapture) 只依赖段内的命令，整体提前到本帧最前面执行，段内整体排序；
+ * 嵌套的截图段从外层段中取出，排在外层段之前执行，不会把外层段拆成分别排序的几段。
+ * 其余命令 (包括使用截图的 DrawCapture / Sprite) 作为一个整体排序，因此在某一帧录制截图
+ * (例如在冻结场景截图的同一帧重新烘焙瓦片区块) 不会打乱屏幕上或外层截图中的绘制顺序。FreeCapture 放在最后。
+ */
+class RenderCommandList final {
+  private:
+    /// @brief 排序用的 (键, 命令下标) 对
+    struct SortItem {
+        Uint64 key;
+        Uint32 index;
+    };
+    /// @brief 排序时尚未结束的截图段
+    struct CaptureFrame {
+        Uint32 beginIndex; ///< @brief BeginCapture 的命令下标
+        size_t itemOffset; ///< @brief 段内命令在 m_captureItems 中的起始位置
+    };
+    static constexpr Uint32 INVALID_COMMAND = 0xFFFFFFFFu; ///< @brief 无效命令下标 (截图段没有 EndCapture)
+
+    std::vector<RenderCommand> m_commands;     ///< @brief 按录制顺序排列的命令
+    std::vector<Uint32> m_order;               ///< @brief 排序后的提交顺序 (命令下标)
+    std::vector<SortItem> m_sortItems;         ///< @brief 基数排序的工作区
+    std::vector<SortItem> m_sortScratch;       ///< @brief 基数排序的交换缓冲区
+    std::vector<SortItem> m_captureItems;      ///< @brief 排序时尚未结束的截图段中的命令 (外层在前)
+    std::vector<CaptureFrame> m_captureFrames; ///< @brief 排序时尚未结束的截图段 (栈)
+    std::string m_stringPool;                  ///< @brief 命令引用的字符串 (不以 '\0' 分隔)
+    glm::vec2 m_viewportSize = {0.0f, 0.0f};   ///< @brief 录制时的相机视口大小，用于提交时的视口裁剪
+    Uint8 m_pass = 0;                          ///< @brief 当前渲染批次 (每个场景一个)，先录制的批次先绘制
+
+  public:
+    RenderCommandList() = default;
+
+    RenderCommandList(const RenderCommandList &) = delete;
+    RenderCommandList &operator=(const RenderCommandList &) = delete;
+    RenderCommandList(RenderCommandList &&) = delete;
+    RenderCommandList &operator=(RenderCommandList &&) = delete;
+
+    void clear(); ///< @brief 清空命令和字符串池 (保留容量)
+
+    /**
+     * @brief 追加一条命令
+     * @param type 命令类型
+     * @param layer 渲染图层 (排序键只含批次与图层，需要按深度排序时再调用 setDepth)
+     * @return 新命令的引用，在下一次 push 之前有效
+     */
+    RenderCommand &push(RenderCommandType type, RenderLayer layer = RenderLayer::UI);
+    /**
+     * @brief 设置命令的深度与纹理排序字段 (只对按深度排序的图层生效)
+     * @param command 由 push 返回的命令
+     * @param depth 深度 (屏幕 Y，越大越晚绘制)
+     * @param textureID 纹理ID，同一深度的命令按纹理聚集
+     */
+    void setDepth(RenderCommand &command, float depth, std::string_view textureID) const;
+    /// @brief 开始新的渲染批次 (每个场景渲染前调用)，之后的命令整体绘制在之前的命令之上
+    void beginPass();
+    /// @brief 按排序键稳定排序，生成提交顺序 (录制结束时调用)
+    void sort();
+    /// @brief 获取提交顺序 (命令下标)
+    const std::vector<Uint32> &getOrder() const { return m_order; }
+    /// @brief 把字符串复制进字符串池，返回其位置
+    StringRef storeString(std::string_view str);
+    /// @brief 读取字符串池中的一段
+    std::string_view getString(StringRef ref) const { return std::string_view(m_stringPool).substr(ref.offset, ref.length); }
+
+    const std::vector<RenderCommand> &getCommands() const { return m_commands; }
+    size_t size() const { return m_commands.size(); }
+    bool empty() const { return m_commands.empty(); }
+
+    void setViewportSize(const glm::vec2 &viewportSize) { m_viewportSize = viewportSize; }
+    const glm::vec2 &getViewportSize() const { return m_viewportSize; }
+
+  private:
+    /// @brief 对 m_sortItems 中的命令做基数排序，结果追加到 m_order 并清空 m_sortItems
+    void flushSortItems();
+    /**
+     * @brief 输出栈顶截图段: BeginCapture、排序后的段内命令与 EndCapture
+     * @param endIndex EndCapture 的命令下标，INVALID_COMMAND 表示没有
+     */
+    void flushCaptureFrame(Uint32 endIndex);
+};
+
+} // namespace engine::render
@@ -1,11 +1,16 @@
 #include "Renderer.hpp"
+#include "../debug/Trace.hpp"
 #include "../resource/ResourceManager.hpp"
 #include "Camera.hpp"
+#include "TextRenderer.hpp"
 
 #include <SDL3/SDL.h>
 #include <spdlog/spdlog.h>
 
+#include <array>
+#include <cmath>
 #include <stdexcept>
+#include <utility>
 
 namespace engine::render {
 
@@ -22,55 +27,166 @@ Renderer::Renderer(SDL_Renderer *renderer, resource::ResourceManager *resourceMa
     spdlog::trace("RENDERER::初始化成功");
 }
 
-/// @name 绘制部分
+/// @name 绘制部分 (录制)
 /// @{
-void Renderer::drawSprite(const Camera &camera, const Sprite &sprite, const glm::vec2 &position, const glm::vec2 &scale, double angle) {
-    auto texture = m_resourceManager->getTexture(sprite.getTextureID());
+void Renderer::drawSprite(const Camera &camera, const Sprite &sprite, const glm::vec2 &position, const glm::vec2 &scale, double angle, RenderLayer layer) {
+    glm::vec2 positionScreen = camera.worldToScreen(position);
+    // 在录制阶段就做视口裁剪，不可见的精灵不进入命令列表；没有源矩形时用整张纹理的尺寸
+    const auto &srcRect = sprite.getSourceRect();
+    glm::vec2 srcSize = srcRect.has_value() ? glm::vec2(srcRect->w, srcRect->h) : m_resourceManager->getTextureSize(sprite.getTextureID());
+    SDL_FRect destRect = {positionScreen.x, positionScreen.y, srcSize.x * scale.x, srcSize.y * scale.y};
+    if (!isRectInViewport(camera.getViewportSize(), destRect)) return;
+    float depth = positionScreen.y + destRect.h; // 以精灵底边 (脚下) 作为深度
+
+    auto &list = getRecordingList();
+    list.setViewportSize(camera.getViewportSize());
+    auto &command = recordSprite(RenderCommandType::Sprite, sprite, layer);
+    command.position = positionScreen;
+    command.size = scale;
+    command.angle = static_cast<float>(angle);
+    list.setDepth(command, depth, sprite.getTextureID());
+}
+
+void Renderer::drawParallax(const Camera &camera, const Sprite &sprite, const glm::vec2 &position, const glm::vec2 &scrollFactor, const glm::bvec2 &repeat, const glm::vec2 &scale) {
+    getRecordingList().setViewportSize(camera.getViewportSize());
+    auto &command = recordSprite(RenderCommandType::Parallax, sprite, RenderLayer::Background);
+    command.position = camera.worldToScreenWithParallax(position, scrollFactor);
+    command.size = scale;
+    command.repeat = repeat;
+}
+
+void Renderer::drawUISprite(const Sprite &sprite, const glm::vec2 &position, const std::optional<glm::vec2> &size) {
+    auto &command = recordSprite(RenderCommandType::UISprite, sprite, RenderLayer::UI);
+    command.position = position;
+    command.hasSize = size.has_value();
+    if (size.has_value()) command.size = size.value();
+}
+
+void Renderer::drawUIFilledRect(const engine::utils::Rect &rect, const engine::utils::FColor &color) {
+    auto &command = getRecordingList().push(RenderCommandType::UIFilledRect);
+    command.position = rect.position;
+    command.size = rect.size;
+    command.color = color;
+}
+
+void Renderer::beginCapture(Uint32 targetID, const std::optional<glm::vec2> &size) {
+    auto &command = getRecordingList().push(RenderCommandType::BeginCapture);
+    command.targetID = targetID;
+    command.hasSize = size.has_value();
+    if (size.has_value()) command.size = size.value();
+}
+
+void Renderer::endCapture() {
+    getRecordingList().push(RenderCommandType::EndCapture);
+}
+
+void Renderer::drawCapture(Uint32 targetID) {
+    getRecordingList().push(RenderCommandType::DrawCapture).targetID = targetID;
+}
+
+void Renderer::drawCaptureSprite(const Camera &camera, Uint32 targetID, const glm::vec2 &position, const glm::vec2 &size, RenderLayer layer) {
+    glm::vec2 positionScreen = camera.worldToScreen(position);
+    SDL_FRect destRect = {positionScreen.x, positionScreen.y, size.x, size.y};
+    if (!isRectInViewport(camera.getViewportSize(), destRect)) return;
+
+    auto &list = getRecordingList();
+    list.setViewportSize(camera.getViewportSize());
+    auto &command = list.push(RenderCommandType::Sprite, layer);
+    command.targetID = targetID;
+    command.hasSourceRect = true;
+    command.sourceRect = {0.0f, 0.0f, size.x, size.y};
+    command.position = positionScreen;
+    list.setDepth(command, positionScreen.y + size.y, {});
+}
+
+void Renderer::clean() {
+    for (auto &[id, texture] : m_captures) {
+        SDL_DestroyTexture(texture);
+    }
+    m_captures.clear();
+    m_captureStack.clear();
+    m_releasedCaptureIDs.clear();
+}
+
+RenderCommand &Renderer::recordSprite(RenderCommandType type, const Sprite &sprite, RenderLayer layer) {
+    auto &list = getRecordingList();
+    StringRef textureID = list.storeString(sprite.getTextureID());
+    auto &command = list.push(type, layer);
+    command.resourceID = textureID;
+    command.isFlipped = sprite.isFlipped();
+    if (sprite.getSourceRect().has_value()) {
+        command.hasSourceRect = true;
+        command.sourceRect = sprite.getSourceRect().value();
+    }
+    return command;
+}
+/// @}
+
+/// @name 命令执行 (主线程)
+/// @{
+void Renderer::executeSprite(const RenderCommandList &list, const RenderCommand &command) {
+    auto textureID = list.getString(command.resourceID);
+    SDL_Texture *texture = nullptr;
+    if (command.targetID != 0) { // 以截图为纹理 (drawCaptureSprite)
+        auto it = m_captures.find(command.targetID);
+        if (it == m_captures.end()) {
+            spdlog::error("RENDERER::drawCaptureSprite::ERROR::截图不存在: ID为{}", command.targetID);
+            return;
+        }
+        texture = it->second;
+    } else {
+        // 与最近的批次使用同一纹理时不再查找 (瓦片层等连续使用同一图集的精灵)
+        for (size_t i = m_batchCount; i > 0 && i + BATCH_LOOKBACK > m_batchCount; --i) {
+            if (m_batches[i - 1].textureID == textureID) {
+                texture = m_batches[i - 1].texture;
+                break;
+            }
+        }
+        if (!texture) texture = m_resourceManager->getTexture(textureID);
+    }
     if (!texture) {
-        spdlog::error("RENDERER::drawSprite::ERROR::获取纹理失败: 纹理ID为{}", sprite.getTextureID());
+        spdlog::error("RENDERER::drawSprite::ERROR::获取纹理失败: 纹理ID为{}", textureID);
         return;
     }
 
-    auto srcRect = getSpriteSrcRect(sprite);
+    auto srcRect = getSourceRect(texture, command);
     if (!srcRect.has_value()) {
-        spdlog::error("RENDERER::drawSprite::ERROR::获取精灵原矩形失败: 纹理ID为{}", sprite.getTextureID());
+        spdlog::error("RENDERER::drawSprite::ERROR::获取精灵原矩形失败: 纹理ID为{}", textureID);
         return;
     }
 
-    glm::vec2 positionScreen = camera.worldToScreen(position);
-
-    float scaledWidth = srcRect.value().w * scale.x;
-    float scaledHeight = srcRect.value().h * scale.y;
+    float scaledWidth = srcRect.value().w * command.size.x;
+    float scaledHeight = srcRect.value().h * command.size.y;
 
-    SDL_FRect destRect = {positionScreen.x, positionScreen.y, scaledWidth, scaledHeight};
+    SDL_FRect destRect = {command.position.x, command.position.y, scaledWidth, scaledHeight};
     // 视口裁剪
-    if (!isRectInViewport(camera, destRect)) return;
+    if (!isRectInViewport(list.getViewportSize(), destRect)) return;
 
-    if (!SDL_RenderTextureRotated(m_renderer, texture, &srcRect.value(), &destRect, angle, NULL, sprite.isFlipped() ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE)) {
-        spdlog::error("RENDERER::drawSprite::ERROR::渲染精灵失败: 纹理ID为{} : {}", sprite.getTextureID(), SDL_GetError());
-    }
+    batchSprite(texture, textureID, srcRect.value(), destRect, command.angle, command.isFlipped);
 }
 
-void Renderer::drawParallax(const Camera &camera, const Sprite &sprite, const glm::vec2 &position, const glm::vec2 &scrollFactor, const glm::bvec2 &repeat, const glm::vec2 &scale) {
-    auto texture = m_resourceManager->getTexture(sprite.getTextureID());
+void Renderer::executeParallax(const RenderCommandList &list, const RenderCommand &command) {
+    ENGINE_TRACE_ZONE("Renderer::drawParallax");
+    auto textureID = list.getString(command.resourceID);
+    auto texture = m_resourceManager->getTexture(textureID);
     if (!texture) {
-        spdlog::error("RENDERER::drawParallax::ERROR::获取纹理失败: 纹理ID为{}", sprite.getTextureID());
+        spdlog::error("RENDERER::drawParallax::ERROR::获取纹理失败: 纹理ID为{}", textureID);
         return;
     }
-    auto srcRect = getSpriteSrcRect(sprite);
+    auto srcRect = getSourceRect(texture, command);
     if (!srcRect.has_value()) {
-        spdlog::error("RENDERER::drawParallax::ERROR::获取精灵原矩形失败: 纹理ID为{}", sprite.getTextureID());
+        spdlog::error("RENDERER::drawParallax::ERROR::获取精灵原矩形失败: 纹理ID为{}", textureID);
         return;
     }
-    glm::vec2 positionScreen = camera.worldToScreenWithParallax(position, scrollFactor);
+    const glm::vec2 &positionScreen = command.position;
 
-    float scaledTextureWidth = srcRect.value().w * scale.x;
-    float scaledTextureHeight = srcRect.value().h * scale.y;
+    float scaledTextureWidth = srcRect.value().w * command.size.x;
+    float scaledTextureHeight = srcRect.value().h * command.size.y;
 
     glm::vec2 start, stop;
-    glm::vec2 viewportSize = camera.getViewportSize();
+    const glm::vec2 &viewportSize = list.getViewportSize();
 
-    if (repeat.x) {
+    if (command.repeat.x) {
         start.x = glm::mod(positionScreen.x, scaledTextureWidth) - scaledTextureWidth;
         stop.x = viewportSize.x;
     } else {
@@ -78,7 +194,7 @@ void Renderer::drawParallax(const Camera &camera, const Sprite &sprite, const gl
         stop.x = glm::min(positionScreen.x + scaledTextureWidth, viewportSize.x);
     }
 
-    if (repeat.y) {
+    if (command.repeat.y) {
         start.y = glm::mod(positionScreen.y, scaledTextureHeight) - scaledTextureHeight;
         stop.y = viewportSize.y;
     } else {
@@ -90,59 +206,283 @@ void Renderer::drawParallax(const Camera &camera, const Sprite &sprite, const gl
         for (float x = start.x; x < stop.x; x += scaledTextureWidth) {
             SDL_FRect dstRect = {x, y, scaledTextureWidth, scaledTextureHeight};
             if (!SDL_RenderTexture(m_renderer, texture, nullptr, &dstRect)) {
-                spdlog::error("RENDERER::drawParallax::ERROR::渲染精灵失败: 纹理ID为{} : {}", sprite.getTextureID(), SDL_GetError());
+                spdlog::error("RENDERER::drawParallax::ERROR::渲染精灵失败: 纹理ID为{} : {}", textureID, SDL_GetError());
                 return;
             }
+            ++m_drawCallCount;
         }
     }
 }
 
-void Renderer::drawUISprite(const Sprite &sprite, const glm::vec2 &position, const std::optional<glm::vec2> &size) {
-    auto texture = m_resourceManager->getTexture(sprite.getTextureID());
+void Renderer::executeUISprite(const RenderCommandList &list, const RenderCommand &command) {
+    auto textureID = list.getString(command.resourceID);
+    auto texture = m_resourceManager->getTexture(textureID);
     if (!texture) {
-        spdlog::error("RENDERER::drawUISprite::ERROR::获取纹理失败: 纹理ID为{}", sprite.getTextureID());
+        spdlog::error("RENDERER::drawUISprite::ERROR::获取纹理失败: 纹理ID为{}", textureID);
         return;
     }
-    auto srcRect = getSpriteSrcRect(sprite);
+    auto srcRect = getSourceRect(texture, command);
     if (!srcRect.has_value()) {
-        spdlog::error("RENDERER::drawUISprite::ERROR::获取精灵原矩形失败: 纹理ID为{}", sprite.getTextureID());
+        spdlog::error("RENDERER::drawUISprite::ERROR::获取精灵原矩形失败: 纹理ID为{}", textureID);
         return;
     }
 
-    SDL_FRect destRect = {position.x, position.y, 0, 0}; // 初始化 destRect, 后续会根据 size 和 srcRect 进行设置
-    if (size.has_value()) {                              // 如果提供尺寸，则使用提供的尺寸
-        destRect.w = size.value().x;
-        destRect.h = size.value().y;
+    SDL_FRect destRect = {command.position.x, command.position.y, 0, 0}; // 初始化 destRect, 后续会根据 size 和 srcRect 进行设置
+    if (command.hasSize) {                                               // 如果提供尺寸，则使用提供的尺寸
+        destRect.w = command.size.x;
+        destRect.h = command.size.y;
     } else { // 如果没有提供尺寸，则使用纹理的原始尺寸
         destRect.w = srcRect.value().w;
         destRect.h = srcRect.value().h;
     }
 
-    if (!SDL_RenderTextureRotated(m_renderer, texture, &srcRect.value(), &destRect, 0.0, NULL, sprite.isFlipped() ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE)) {
-        spdlog::error("RENDERER::drawUISprite::ERROR::渲染 UI Sprite 失败: 纹理ID为{} : {}", sprite.getTextureID(), SDL_GetError());
+    if (!SDL_RenderTextureRotated(m_renderer, texture, &srcRect.value(), &destRect, 0.0, NULL, command.isFlipped ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE)) {
+        spdlog::error("RENDERER::drawUISprite::ERROR::渲染 UI Sprite 失败: 纹理ID为{} : {}", textureID, SDL_GetError());
     }
+    ++m_drawCallCount;
 }
-void Renderer::drawUIFilledRect(const engine::utils::Rect &rect, const engine::utils::FColor &color) {
-    setDrawColorFloat(color.r, color.g, color.b, color.a);
-    SDL_FRect SDLRect = {rect.position.x, rect.position.y, rect.size.x, rect.size.y};
+
+void Renderer::executeUIFilledRect(const RenderCommand &command) {
+    setDrawColorFloat(command.color.r, command.color.g, command.color.b, command.color.a);
+    SDL_FRect SDLRect = {command.position.x, command.position.y, command.size.x, command.size.y};
     if (!SDL_RenderFillRect(m_renderer, &SDLRect)) {
         spdlog::error("RENDERER::drawUIFilledRect::ERROR::绘制填充矩形失败：{}", SDL_GetError());
     }
+    ++m_drawCallCount;
     setDrawColor(0, 0, 0, 1.0f);
 }
+
+void Renderer::executeBeginCapture(const RenderCommand &command) {
+    // 截图与屏幕的逻辑分辨率一致，命令中的屏幕坐标可以原样绘制到截图中
+    int width = 0;
+    int height = 0;
+    SDL_RendererLogicalPresentation mode;
+    SDL_GetRenderLogicalPresentation(m_renderer, &width, &height, &mode);
+    if (width <= 0 || height <= 0) {
+        SDL_GetCurrentRenderOutputSize(m_renderer, &width, &height);
+    }
+    if (command.hasSize) {
+        width = static_cast<int>(std::ceil(command.size.x));
+        height = static_cast<int>(std::ceil(command.size.y));
+    }
+
+    SDL_Texture *&texture = m_captures[command.targetID];
+    if (texture && (texture->w != width || texture->h != height)) { // 尺寸 (逻辑分辨率) 改变后重新创建
+        SDL_DestroyTexture(texture);
+        texture = nullptr;
+    }
+    if (!texture) {
+        texture = SDL_CreateTexture(m_renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+        if (!texture) {
+            spdlog::error("RENDERER::beginCapture::ERROR::创建截图纹理失败: {}", SDL_GetError());
+            m_captures.erase(command.targetID);
+            return;
+        }
+        SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
+        // 截图在透明背景上以普通混合绘制，颜色已预乘 alpha，铺到屏幕时需用预乘混合
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+    }
+    if (!SDL_SetRenderTarget(m_renderer, texture)) {
+        spdlog::error("RENDERER::beginCapture::ERROR::设置渲染目标失败: {}", SDL_GetError());
+        return;
+    }
+    m_captureStack.push_back(texture);
+    setDrawColor(0, 0, 0, 0);
+    SDL_RenderClear(m_renderer);
+    setDrawColor(0, 0, 0, 255);
+}
+
+void Renderer::executeEndCapture() {
+    if (m_captureStack.empty()) return; // 对应的 beginCapture 失败
+    m_captureStack.pop_back();
+    if (!SDL_SetRenderTarget(m_renderer, m_captureStack.empty() ? nullptr : m_captureStack.back())) {
+        spdlog::error("RENDERER::endCapture::ERROR::恢复渲染目标失败: {}", SDL_GetError());
+    }
+}
+
+void Renderer::executeDrawCapture(const RenderCommand &command) {
+    auto it = m_captures.find(command.targetID);
+    if (it == m_captures.end()) {
+        spdlog::error("RENDERER::drawCapture::ERROR::截图不存在: ID为{}", command.targetID);
+        return;
+    }
+    SDL_FRect destRect = {0, 0, static_cast<float>(it->second->w), static_cast<float>(it->second->h)};
+    if (!SDL_RenderTexture(m_renderer, it->second, nullptr, &destRect)) {
+        spdlog::error("RENDERER::drawCapture::ERROR::绘制截图失败: {}", SDL_GetError());
+    }
+    ++m_drawCallCount;
+}
+
+void Renderer::executeFreeCapture(const RenderCommand &command) {
+    auto it = m_captures.find(command.targetID);
+    if (it == m_captures.end()) return; // 从未提交过 beginCapture
+    SDL_DestroyTexture(it->second);
+    m_captures.erase(it);
+}
+/// @}
+
+/// @name 精灵批处理 (主线程)
+/// @{
+void Renderer::batchSprite(SDL_Texture *texture, std::string_view textureID, const SDL_FRect &srcRect, const SDL_FRect &destRect, float angle, bool isFlipped) {
+    // 四个角相对目标矩形中心的位置，与 SDL_RenderTextureRotated 一致: 绕中心顺时针旋转 (屏幕 y 轴向下)
+    glm::vec2 halfSize = {destRect.w * 0.5f, destRect.h * 0.5f};
+    glm::vec2 center = {destRect.x + halfSize.x, destRect.y + halfSize.y};
+    std::array<glm::vec2, 4> corners = {glm::vec2{-halfSize.x, -halfSize.y}, glm::vec2{halfSize.x, -halfSize.y},
+                                        glm::vec2{halfSize.x, halfSize.y}, glm::vec2{-halfSize.x, halfSize.y}};
+    SDL_FRect bounds = destRect;
+    if (angle != 0.0f) {
+        float radians = glm::radians(angle);
+        float cosine = std::cos(radians);
+        float sine = std::sin(radians);
+        glm::vec2 extent = {0.0f, 0.0f};
+        for (auto &corner : corners) {
+            corner = {corner.x * cosine - corner.y * sine, corner.x * sine + corner.y * cosine};
+            extent = glm::max(extent, glm::abs(corner));
+        }
+        bounds = {center.x - extent.x, center.y - extent.y, extent.x * 2.0f, extent.y * 2.0f};
+    }
+
+    auto &batch = findBatch(texture, textureID, bounds);
+
+    // 归一化纹理坐标，水平翻转时交换左右
+    float u0 = srcRect.x / static_cast<float>(texture->w);
+    float u1 = (srcRect.x + srcRect.w) / static_cast<float>(texture->w);
+    float v0 = srcRect.y / static_cast<float>(texture->h);
+    float v1 = (srcRect.y + srcRect.h) / static_cast<float>(texture->h);
+    if (isFlipped) std::swap(u0, u1);
+    const std::array<SDL_FPoint, 4> texCoords = {SDL_FPoint{u0, v0}, SDL_FPoint{u1, v0}, SDL_FPoint{u1, v1}, SDL_FPoint{u0, v1}};
+
+    int base = static_cast<int>(batch.vertices.size());
+    for (size_t i = 0; i < corners.size(); ++i) {
+        batch.vertices.push_back({{center.x + corners[i].x, center.y + corners[i].y}, {1.0f, 1.0f, 1.0f, 1.0f}, texCoords[i]});
+    }
+    batch.indices.insert(batch.indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+}
+
+Renderer::SpriteBatch &Renderer::findBatch(SDL_Texture *texture, std::string_view textureID, const SDL_FRect &bounds) {
+    auto addBounds = [&bounds](SpriteBatch &batch) -> SpriteBatch & {
+        if (batch.quadBounds.empty()) {
+            batch.bounds = bounds;
+        } else {
+            SDL_GetRectUnionFloat(&batch.bounds, &bounds, &batch.bounds);
+        }
+        batch.quadBounds.push_back(bounds);
+        return batch;
+    };
+    // 从后向前查找同纹理的批次；精灵会被提前到越过的批次之前绘制，因此不能与其中任何精灵相交
+    for (size_t i = m_batchCount; i > 0 && i + BATCH_LOOKBACK > m_batchCount; --i) {
+        auto &batch = m_batches[i - 1];
+        if (batch.texture == texture) return addBounds(batch);
+        if (!SDL_HasRectIntersectionFloat(&batch.bounds, &bounds)) continue;
+        bool isBlocked = false;
+        for (const auto &quad : batch.quadBounds) {
+            if (SDL_HasRectIntersectionFloat(&quad, &bounds)) {
+                isBlocked = true;
+                break;
+            }
+        }
+        if (isBlocked) break;
+    }
+    if (m_batchCount == m_batches.size()) m_batches.emplace_back();
+    auto &batch = m_batches[m_batchCount++];
+    batch.texture = texture;
+    batch.textureID = textureID;
+    return addBounds(batch);
+}
+
+void Renderer::flushBatch() {
+    for (size_t i = 0; i < m_batchCount; ++i) {
+        auto &batch = m_batches[i];
+        if (!SDL_RenderGeometry(m_renderer, batch.texture, batch.vertices.data(), static_cast<int>(batch.vertices.size()),
+                                batch.indices.data(), static_cast<int>(batch.indices.size()))) {
+            spdlog::error("RENDERER::flushBatch::ERROR::批量渲染精灵失败: 纹理ID为{} : {}", batch.textureID, SDL_GetError());
+        }
+        ++m_drawCallCount;
+        // 只重置大小，稳定运行后不再分配内存
+        batch.vertices.clear();
+        batch.indices.clear();
+        batch.quadBounds.clear();
+        batch.texture = nullptr;
+        batch.textureID = {};
+    }
+    m_batchCount = 0;
+}
 /// @}
 
 /// @name 渲染部分
 /// @{
 void Renderer::present() {
+    ENGINE_TRACE_ZONE("Renderer::present");
     SDL_RenderPresent(m_renderer);
 }
 
 void Renderer::clearScreen() {
+    ENGINE_TRACE_ZONE("Renderer::clearScreen");
     if (!SDL_RenderClear(m_renderer)) {
         spdlog::error("RENDERER::clearScreen::ERROR::清屏失败: {}", SDL_GetError());
     }
 }
+
+void Renderer::beginRecording() {
+    auto &list = getRecordingList();
+    list.clear();
+    for (auto targetID : m_releasedCaptureIDs) {
+        list.push(RenderCommandType::FreeCapture).targetID = targetID;
+    }
+    m_releasedCaptureIDs.clear();
+}
+
+void Renderer::endRecording() {
+    ENGINE_TRACE_ZONE("Renderer::endRecording");
+    getRecordingList().sort();
+}
+
+void Renderer::swapCommandLists() {
+    m_recordIndex = 1 - m_recordIndex;
+}
+
+void Renderer::submitCommands(TextRenderer &textRenderer) {
+    ENGINE_TRACE_ZONE("Renderer::submitCommands");
+    const auto &list = getSubmitList();
+    m_drawCallCount = 0;
+    const auto &commands = list.getCommands();
+    for (auto index : list.getOrder()) {
+        const auto &command = commands[index];
+        // 其他类型的命令会改变绘制状态或渲染目标，先提交已累积的精灵，保持绘制顺序
+        if (command.type != RenderCommandType::Sprite) flushBatch();
+        switch (command.type) {
+        case RenderCommandType::Sprite:
+            executeSprite(list, command);
+            break;
+        case RenderCommandType::Parallax:
+            executeParallax(list, command);
+            break;
+        case RenderCommandType::UISprite:
+            executeUISprite(list, command);
+            break;
+        case RenderCommandType::UIFilledRect:
+            executeUIFilledRect(command);
+            break;
+        case RenderCommandType::UIText:
+            textRenderer.renderUIText(list.getString(command.text), list.getString(command.resourceID), command.fontSize, command.position, command.color);
+            ++m_drawCallCount;
+            break;
+        case RenderCommandType::BeginCapture:
+            executeBeginCapture(command);
+            break;
+        case RenderCommandType::EndCapture:
+            executeEndCapture();
+            break;
+        case RenderCommandType::DrawCapture:
+            executeDrawCapture(command);
+            break;
+        case RenderCommandType::FreeCapture:
+            executeFreeCapture(command);
+            break;
+        }
+    }
+    flushBatch();
+}
 /// @}
 
 /// @name getter / setter
@@ -164,34 +504,26 @@ SDL_Renderer *Renderer::getSDLRenderer() const {
 }
 /// @}
 
-std::optional<SDL_FRect> Renderer::getSpriteSrcRect(const Sprite &sprite) {
-    SDL_Texture *texture = m_resourceManager->getTexture(sprite.getTextureID());
-    if (!texture) {
-        spdlog::error("RENDERER::getSpriteSrcRect::ERROR::获取纹理失败: 纹理ID为{}", sprite.getTextureID());
-        return std::nullopt;
-    }
-
-    auto srcRect = sprite.getSourceRect();
-    if (srcRect.has_value()) {
-        if (srcRect.value().w <= 0 || srcRect.value().h <= 0) {
-            spdlog::error("RENDERER::getSpriteSrcRect::ERROR::精灵原矩形错误: 纹理ID为{}", sprite.getTextureID());
+std::optional<SDL_FRect> Renderer::getSourceRect(SDL_Texture *texture, const RenderCommand &command) {
+    if (command.hasSourceRect) {
+        if (command.sourceRect.w <= 0 || command.sourceRect.h <= 0) {
+            spdlog::error("RENDERER::getSourceRect::ERROR::精灵原矩形错误");
             return std::nullopt;
         }
-        return srcRect;
+        return command.sourceRect;
     } else {
         SDL_FRect result = {0, 0, 0, 0};
         if (!SDL_GetTextureSize(texture, &result.w, &result.h)) {
-            spdlog::error("RENDERER::getSpriteSrcRect::ERROR::获取精灵原矩形失败: 纹理ID为{}", sprite.getTextureID());
+            spdlog::error("RENDERER::getSourceRect::ERROR::获取纹理尺寸失败: {}", SDL_GetError());
             return std::nullopt;
         }
         return result;
     }
 }
 
-bool Renderer::isRectInViewport(const Camera &camera, const SDL_FRect &rect) {
-    glm::vec2 viewportSize = camera.getViewportSize();
+bool Renderer::isRectInViewport(const glm::vec2 &viewportSize, const SDL_FRect &rect) const {
     return rect.x + rect.w >= 0 && rect.x <= viewportSize.x && // 相当于 AABB 的碰撞检测
            rect.y + rect.h >= 0 && rect.y <= viewportSize.y;
 }
 
-} // namespace engine::render
\ No newline at end of file
+} // namespace engine::render
@@ -1,14 +1,21 @@
 #pragma once
 #include "../utils/Math.hpp"
+#include "RenderCommand.hpp"
 #include "Sprite.hpp"
 
+#include <SDL3/SDL_render.h>
 #include <glm/glm.hpp>
 
+#include <array>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 struct SDL_Renderer;
 struct SDL_FRect;
+struct SDL_Texture;
 
 namespace engine::resource {
 class ResourceManager;
@@ -17,6 +24,7 @@ class ResourceManager;
 namespace engine::render {
 class Sprite;
 class Camera;
+class TextRenderer;
 
 /**
  * @class Renderer
@@ -24,11 +32,46 @@ class Camera;
  *
  * 这个类封装了SDL渲染器的功能，提供了精灵绘制、视差滚动、UI元素渲染等功能。
  * 它与游戏资源管理器和相机系统紧密集成，以实现高效的渲染流程。
+ *
+ * 绘制接口 (draw*) 不直接调用 SDL，而是把完成相机变换后的命令录制到双缓冲命令列表中；
+ * submitCommands() 在主线程把另一份列表提交给 SDL。因此录制可以在模拟线程中进行，
+ * 与主线程提交上一帧的命令重叠。
+ *
+ * 提交时使用同一纹理的 Sprite 命令合并为一批，用一次 SDL_RenderGeometry 绘制 (每个精灵一个四边形)。
+ * 纹理交替出现时，精灵只要与中间其他纹理的精灵不相交就合并到更早的同纹理批次 (见 batchSprite)，
+ * 遇到其他类型的命令时先提交所有批次，因此重叠精灵之间的绘制顺序 (图层与深度顺序) 不变，
+ * 瓦片层这类同一图集的大量精灵只需要一次绘制调用，按 Y 交错的单位也不再每个精灵一次绘制调用。
+ *
+ * 每条命令带有 64 位排序键 (批次、图层、深度、纹理)，录制结束时 (endRecording) 基数排序一次，
+ * 提交按排序后的顺序进行：绘制顺序由图层决定而不是录制顺序，单位层按精灵底边的屏幕 Y 排序，
+ * 同一深度的相邻精灵按纹理聚在一起以便合批。
  */
 class Renderer final {
   private:
     SDL_Renderer *m_renderer = nullptr;                     ///< SDL渲染器指针
     resource::ResourceManager *m_resourceManager = nullptr; ///< 资源管理器指针
+    float m_interpolationAlpha = 1.0f;                      ///< 本帧的渲染插值系数（固定步长模式下由 Game 每帧设置）
+    std::array<RenderCommandList, 2> m_commandLists;        ///< 双缓冲命令列表，一份录制、一份提交
+    size_t m_recordIndex = 0;                               ///< 正在录制的命令列表索引
+    Uint32 m_nextCaptureID = 1;                             ///< 下一个截图渲染目标ID (录制线程分配，0 表示无效)
+    std::unordered_map<Uint32, SDL_Texture *> m_captures;   ///< 截图渲染目标 (只在主线程提交命令时创建 / 销毁)
+    std::vector<Uint32> m_releasedCaptureIDs;               ///< 待释放的截图ID (录制线程)，下一次 beginRecording 时录制为 FreeCapture
+    std::vector<SDL_Texture *> m_captureStack;              ///< 正在绘制的截图 (主线程)，截图可以嵌套
+
+    /// @brief 一个待提交的精灵批次 (同一纹理，一次 SDL_RenderGeometry 提交)
+    struct SpriteBatch {
+        SDL_Texture *texture = nullptr;    ///< 批次的纹理
+        std::string_view textureID;        ///< 纹理ID (指向提交列表的字符串池，只在一次提交内有效)
+        std::vector<SDL_Vertex> vertices;  ///< 顶点 (每个精灵 4 个)
+        std::vector<int> indices;          ///< 索引 (每个精灵 6 个)
+        std::vector<SDL_FRect> quadBounds; ///< 每个精灵的包围盒，判断后来的精灵能否越过本批次
+        SDL_FRect bounds = {};             ///< 所有精灵包围盒的并集，先用它快速排除不相交的情况
+    };
+    static constexpr size_t BATCH_LOOKBACK = 8; ///< 精灵最多越过几个其他纹理的批次，合并到更早的同纹理批次
+
+    std::vector<SpriteBatch> m_batches; ///< 待提交的精灵批次 (按绘制顺序，只使用前 m_batchCount 个，保留容量避免每帧分配)
+    size_t m_batchCount = 0;            ///< 待提交的批次数
+    size_t m_drawCallCount = 0;         ///< 上一次提交发出的绘制调用数
 
   public:
     /**
@@ -49,11 +92,12 @@ class Renderer final {
      * @param position 精灵在游戏世界中的位置
      * @param scale    精灵的缩放比例，默认为(1.0f, 1.0f)
      * @param angle    精灵的旋转角度（度），默认为0.0
+     * @param layer    渲染图层，默认为单位层 (按精灵底边的屏幕 Y 排序)
      *
-     * 此方法会将精灵根据相机位置进行视口变换后绘制到屏幕上
+     * 此方法会将精灵根据相机位置进行视口变换后录制为绘制命令
      */
     void drawSprite(const Camera &camera, const Sprite &sprite, const glm::vec2 &position,
-                    const glm::vec2 &scale = glm::vec2(1.0f), double angle = 0.0);
+                    const glm::vec2 &scale = glm::vec2(1.0f), double angle = 0.0, RenderLayer layer = RenderLayer::Units);
 
     /**
      * @brief 绘制视差滚动背景
@@ -87,10 +131,58 @@ class Renderer final {
     void drawUIFilledRect(const engine::utils::Rect &rect, const engine::utils::FColor &color);
     /// @}
 
+    /// @name 截图 (把一组命令缓存到纹理中，之后只需绘制一次纹理)
+    /// @{
+    /// @brief 分配一个截图渲染目标ID (纹理在第一次 beginCapture 提交时创建)
+    Uint32 createCaptureTarget() { return m_nextCaptureID++; }
+    /**
+     * @brief 录制: 之后的命令绘制到截图中 (截图先被清空为透明)
+     * @param targetID 截图ID
+     * @param size 截图尺寸 (像素)，为空时使用逻辑分辨率 (此时命令中的屏幕坐标可以原样绘制到截图中)
+     */
+    void beginCapture(Uint32 targetID, const std::optional<glm::vec2> &size = std::nullopt);
+    /// @brief 录制: 结束截图，恢复绘制到上一层截图或屏幕
+    void endCapture();
+    /// @brief 录制: 把截图铺满屏幕
+    void drawCapture(Uint32 targetID);
+    /**
+     * @brief 录制: 把截图作为世界空间精灵绘制 (参与图层排序与合批，例如烘焙好的瓦片区块)
+     * @param camera 相机对象，用于计算视口变换
+     * @param targetID 截图ID
+     * @param position 截图左上角在游戏世界中的位置
+     * @param size 截图尺寸 (与 beginCapture 时一致)
+     * @param layer 渲染图层
+     */
+    void drawCaptureSprite(const Camera &camera, Uint32 targetID, const glm::vec2 &position, const glm::vec2 &size, RenderLayer layer);
+    /// @brief 销毁截图渲染目标 (不再使用的ID必须释放，否则纹理会保留到 clean())。可以在录制之外调用，下一帧录制时生效
+    void releaseCaptureTarget(Uint32 targetID) { m_releasedCaptureIDs.push_back(targetID); }
+    /// @brief 销毁所有截图渲染目标 (必须在 SDL_Renderer 销毁前、主线程调用)
+    void clean();
+    /// @}
+
     /// @name 渲染部分
     /// @{
     void present();
     void clearScreen();
+    /// @brief 清空录制中的命令列表，开始录制新的一帧
+    void beginRecording();
+    /// @brief 开始新的渲染批次 (每个场景渲染前调用)，后录制的场景整体绘制在先录制的场景之上
+    void beginRenderPass() { getRecordingList().beginPass(); }
+    /// @brief 结束录制: 按图层与深度排序本帧的命令 (在录制线程调用，提交时不再排序)
+    void endRecording();
+    /// @brief 交换录制列表与提交列表 (必须在录制线程和提交线程都空闲时调用)
+    void swapCommandLists();
+    /**
+     * @brief 把提交列表中的命令按顺序绘制到 SDL 渲染器 (只能在主线程调用)
+     * @param textRenderer 用于执行文本命令的文本渲染器
+     */
+    void submitCommands(TextRenderer &textRenderer);
+    /// @brief 获取正在录制的命令列表
+    RenderCommandList &getRecordingList() { return m_commandLists[m_recordIndex]; }
+    /// @brief 获取等待提交的命令列表
+    const RenderCommandList &getSubmitList() const { return m_commandLists[1 - m_recordIndex]; }
+    /// @brief 获取上一次提交发出的 SDL 绘制调用数 (一个精灵批次计为一次)
+    size_t getDrawCallCount() const { return m_drawCallCount; }
     /// @}
 
     /// @name getter / setter
@@ -122,6 +214,14 @@ class Renderer final {
      * 返回与此渲染器关联的SDL渲染器指针，可用于需要直接操作SDL渲染器的特殊情况
      */
     SDL_Renderer *getSDLRenderer() const;
+    /**
+     * @brief 设置渲染插值系数
+     * @param alpha 当前时刻位于上一个与当前模拟状态之间的比例，范围 [0, 1]
+     *
+     * 固定步长模式下渲染帧与模拟步不同步，组件在渲染时据此混合前后两次模拟的位置
+     */
+    void setInterpolationAlpha(float alpha) { m_interpolationAlpha = alpha; }
+    float getInterpolationAlpha() const { return m_interpolationAlpha; }
     /// @}
 
     Renderer(const Renderer &) = delete;
@@ -130,24 +230,67 @@ class Renderer final {
     Renderer &operator=(Renderer &&) = delete;
 
   private:
+    /// @name 命令执行 (主线程)
+    /// @{
+    void executeSprite(const RenderCommandList &list, const RenderCommand &command);
+    void executeParallax(const RenderCommandList &list, const RenderCommand &command);
+    void executeUISprite(const RenderCommandList &list, const RenderCommand &command);
+    void executeUIFilledRect(const RenderCommand &command);
+    void executeBeginCapture(const RenderCommand &command);
+    void executeEndCapture();
+    void executeDrawCapture(const RenderCommand &command);
+    void executeFreeCapture(const RenderCommand &command);
+    /// @}
+
+    /// @name 精灵批处理 (主线程)
+    /// @{
+    /**
+     * @brief 把一个精灵加入批次
+     *
+     * 优先加入最后一个批次；纹理不同时向前查找同纹理的批次，只要精灵与中间越过的批次中的精灵都不相交，
+     * 提前绘制它不会改变遮挡结果 (按 Y 交错的不同单位因此可以合批)，否则在末尾开始新批次。
+     * @param texture 纹理
+     * @param textureID 纹理ID (截图为空)
+     * @param srcRect 源矩形
+     * @param destRect 目标矩形 (屏幕坐标)
+     * @param angle 绕目标矩形中心的旋转角度 (度，顺时针)
+     * @param isFlipped 是否水平翻转
+     */
+    void batchSprite(SDL_Texture *texture, std::string_view textureID, const SDL_FRect &srcRect, const SDL_FRect &destRect, float angle, bool isFlipped);
+    /// @brief 找到包围盒为 bounds 的精灵可以加入的批次，没有时在末尾开始新批次
+    SpriteBatch &findBatch(SDL_Texture *texture, std::string_view textureID, const SDL_FRect &bounds);
+    /// @brief 按顺序提交所有待提交的批次，每个批次一次 SDL_RenderGeometry
+    void flushBatch();
+    /// @}
+
     /**
-     * @brief 获取精灵的源矩形
+     * @brief 录制一条精灵类命令的公共部分 (纹理ID、源矩形、翻转)
+     * @param type 命令类型
      * @param sprite 精灵对象
-     * @return std::optional<SDL_FRect> 精灵的源矩形，如果没有有效矩形则返回空
+     * @param layer 渲染图层
+     * @return 新命令的引用
+     */
+    RenderCommand &recordSprite(RenderCommandType type, const Sprite &sprite, RenderLayer layer);
+
+    /**
+     * @brief 获取命令的源矩形
+     * @param texture 命令使用的纹理
+     * @param command 绘制命令
+     * @return std::optional<SDL_FRect> 源矩形，如果没有有效矩形则返回空
      *
-     * 根据精灵的当前帧和动画状态，返回相应的源矩形区域
+     * 命令记录了源矩形时直接使用，否则使用整张纹理的尺寸
      */
-    std::optional<SDL_FRect> getSpriteSrcRect(const Sprite &sprite);
+    std::optional<SDL_FRect> getSourceRect(SDL_Texture *texture, const RenderCommand &command);
 
     /**
      * @brief 检查矩形是否在视口中可见
-     * @param camera 相机对象
+     * @param viewportSize 视口大小
      * @param rect 要检查的矩形
      * @return bool 如果矩形在视口中可见则返回true，否则返回false
      *
      * 用于优化渲染，只绘制可见区域的精灵
      */
-    bool isRectInViewport(const Camera &camera, const SDL_FRect &rect);
+    bool isRectInViewport(const glm::vec2 &viewportSize, const SDL_FRect &rect) const;
 };
 
-} // namespace engine::render
\ No newline at end of file
+} // namespace engine::render
@@ -1,16 +1,18 @@
 #include "TextRenderer.hpp"
+#include "../debug/Trace.hpp"
 #include "../resource/ResourceManager.hpp"
 #include "Camera.hpp"
+#include "Renderer.hpp"
 #include <SDL3_ttf/SDL_ttf.h>
 #include <spdlog/spdlog.h>
 #include <stdexcept>
 
 namespace engine::render {
 
-TextRenderer::TextRenderer(SDL_Renderer *SDLRenderer, engine::resource::ResourceManager *resourceManager)
-    : m_SDLRenderer(SDLRenderer), m_resourceManager(resourceManager) {
-    if (!m_SDLRenderer || !m_resourceManager) {
-        throw std::runtime_error("TextRenderer 需要一个有效的 SDLRenderer 和 ResourceManager。");
+TextRenderer::TextRenderer(SDL_Renderer *SDLRenderer, engine::resource::ResourceManager *resourceManager, Renderer *renderer)
+    : m_SDLRenderer(SDLRenderer), m_resourceManager(resourceManager), m_renderer(renderer) {
+    if (!m_SDLRenderer || !m_resourceManager || !m_renderer) {
+        throw std::runtime_error("TextRenderer 需要一个有效的 SDLRenderer、ResourceManager 和 Renderer。");
     }
     // 初始化 SDL_ttf
     if (!TTF_WasInit() && TTF_Init() == false) {
@@ -41,30 +43,44 @@ void TextRenderer::close() {
 }
 
 void TextRenderer::drawUIText(std::string_view text, std::string_view fontID, int fontSize, const glm::vec2 &position, const utils::FColor &color) {
+    auto &list = m_renderer->getRecordingList();
+    StringRef textRef = list.storeString(text);
+    StringRef fontRef = list.storeString(fontID);
+    auto &command = list.push(RenderCommandType::UIText);
+    command.text = textRef;
+    command.resourceID = fontRef;
+    command.fontSize = fontSize;
+    command.position = position;
+    command.color = color;
+}
+
+void TextRenderer::renderUIText(std::string_view text, std::string_view fontID, int fontSize, const glm::vec2 &position, const utils::FColor &color) {
+    ENGINE_TRACE_ZONE("TextRenderer::renderUIText");
+    std::lock_guard<std::mutex> lock(m_fontMutex);
     /* 构造函数已经保证了必要指针不会为空，这里不需要再检查 */
     TTF_Font *font = m_resourceManager->getFont(fontID, fontSize);
     if (!font) {
-        spdlog::warn("drawUIText 获取字体失败: {} 大小 {}", fontID, fontSize);
+        spdlog::warn("renderUIText 获取字体失败: {} 大小 {}", fontID, fontSize);
         return;
     }
 
     // 创建临时 TTF_Text 对象   (目前效率不高，未来可以考虑使用缓存优化)
-    TTF_Text *tempTextObject = TTF_CreateText(m_textEngine, font, text.data(), 0);
+    TTF_Text *tempTextObject = TTF_CreateText(m_textEngine, font, text.data(), text.size());
     if (!tempTextObject) {
-        spdlog::error("drawUIText 创建临时 TTF_Text 失败: {}", SDL_GetError());
+        spdlog::error("renderUIText 创建临时 TTF_Text 失败: {}", SDL_GetError());
         return;
     }
 
     // 先渲染一次黑色文字模拟阴影
     TTF_SetTextColorFloat(tempTextObject, 0.0f, 0.0f, 0.0f, 1.0f);
     if (!TTF_DrawRendererText(tempTextObject, position.x + 2, position.y + 2)) {
-        spdlog::error("drawUIText 绘制临时 TTF_Text 失败: {}", SDL_GetError());
+        spdlog::error("renderUIText 绘制临时 TTF_Text 失败: {}", SDL_GetError());
     }
 
     // 然后正常绘制
     TTF_SetTextColorFloat(tempTextObject, color.r, color.g, color.b, color.a);
     if (!TTF_DrawRendererText(tempTextObject, position.x, position.y)) {
-        spdlog::error("drawUIText 绘制临时 TTF_Text 失败: {}", SDL_GetError());
+        spdlog::error("renderUIText 绘制临时 TTF_Text 失败: {}", SDL_GetError());
     }
 
     // 销毁临时 TTF_Text 对象
@@ -79,6 +95,8 @@ void TextRenderer::drawText(const Camera &camera, std::string_view text, std::st
 }
 
 glm::vec2 TextRenderer::getTextSize(std::string_view text, std::string_view fontID, int fontSize) {
+    ENGINE_TRACE_ZONE("TextRenderer::getTextSize");
+    std::lock_guard<std::mutex> lock(m_fontMutex);
     /* 构造函数已经保证了必要指针不会为空，这里不需要再检查 */
     TTF_Font *font = m_resourceManager->getFont(fontID, fontSize);
     if (!font) {
@@ -86,19 +104,14 @@ glm::vec2 TextRenderer::getTextSize(std::string_view text, std::string_view font
         return glm::vec2(0.0f, 0.0f);
     }
 
-    // 创建临时 TTF_Text 对象
-    TTF_Text *tempTextObject = TTF_CreateText(m_textEngine, font, text.data(), 0);
-    if (!tempTextObject) {
-        spdlog::error("getTextSize 创建临时 TTF_Text 失败: {}", SDL_GetError());
+    // 直接测量字符串，不经过 TTF_TextEngine (它绑定了 SDL 渲染器，只能在主线程使用)
+    int width = 0;
+    int height = 0;
+    if (!TTF_GetStringSize(font, text.data(), text.size(), &width, &height)) {
+        spdlog::error("getTextSize 测量文本失败: {}", SDL_GetError());
         return glm::vec2(0.0f, 0.0f);
     }
 
-    int width, height;
-    TTF_GetTextSize(tempTextObject, &width, &height);
-
-    // 销毁临时 TTF_Text 对象
-    TTF_DestroyText(tempTextObject);
-
     return glm::vec2(static_cast<float>(width), static_cast<float>(height));
 }
 
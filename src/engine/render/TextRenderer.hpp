@@ -2,6 +2,7 @@
 #include "../utils/Math.hpp"
 #include <SDL3/SDL_render.h>
 #include <glm/vec2.hpp>
+#include <mutex>
 #include <string>
 #include <string_view>
 
@@ -13,33 +14,41 @@ class ResourceManager;
 
 namespace engine::render {
 class Camera;
+class Renderer;
 /**
  * @brief 使用 SDL_ttf 和 TTF_Text 对象处理文本渲染。
  *
  * 封装 TTF_TextEngine 并提供创建和绘制 TTF_Text 对象的方法，
  * 管理字体加载和颜色设置。
+ * drawUIText / drawText 与 Renderer 的绘制接口一样只录制命令，由 Renderer::submitCommands 调用 renderUIText 实际绘制。
+ *
+ * 线程安全：getTextSize 可以在模拟线程调用 (UILabel::setText)，它不使用 TTF_TextEngine (只在主线程绘制时使用)，
+ * 并与 renderUIText 共用一把锁，同一个 TTF_Font 不会被两个线程同时使用。
  */
 class TextRenderer final {
   private:
     SDL_Renderer *m_SDLRenderer = nullptr;                          ///< @brief 持有渲染器的非拥有指针
     engine::resource::ResourceManager *m_resourceManager = nullptr; ///< @brief 持有资源管理器的非拥有指针
+    Renderer *m_renderer = nullptr;                                 ///< @brief 持有渲染器的非拥有指针 (文本命令录制到其命令列表)
 
-    TTF_TextEngine *m_textEngine = nullptr; ///< @brief 使用SDL3引入的 TTF_TextEngine 来进行绘制
+    TTF_TextEngine *m_textEngine = nullptr; ///< @brief 使用SDL3引入的 TTF_TextEngine 来进行绘制 (只在主线程使用)
+    std::mutex m_fontMutex;                 ///< @brief 串行化对 TTF_Font 的使用 (模拟线程测量文本、主线程绘制文本)
 
   public:
     /**
      * @brief 构造 TextRenderer。
      * @param SDLRenderer 有效的 SDLRenderer 指针。
      * @param resourceManager 有效的 ResourceManager 指针（用于字体加载）。
+     * @param renderer 有效的 Renderer 指针（用于录制文本命令）。
      * @throws std::runtime_error 如果初始化失败。
      */
-    TextRenderer(SDL_Renderer *SDLRenderer, engine::resource::ResourceManager *resourceManager);
+    TextRenderer(SDL_Renderer *SDLRenderer, engine::resource::ResourceManager *resourceManager, Renderer *renderer);
     ~TextRenderer(); ///< @brief 析构函数，按需调用close()。
 
     void close(); ///< @brief 显式关闭。清理 TTF_TextEngine 并关闭SDL_ttf。
 
     /**
-     * @brief 绘制UI上的字符串。
+     * @brief 绘制UI上的字符串 (录制为文本命令)。
      * @param text UTF-8 字符串内容。
      * @param fontID 字体 ID。
      * @param fontSize 字体大小。
@@ -48,6 +57,16 @@ class TextRenderer final {
      */
     void drawUIText(std::string_view text, std::string_view fontID, int fontSize, const glm::vec2 &position, const utils::FColor &color = {1.0f, 1.0f, 1.0f, 1.0f});
 
+    /**
+     * @brief 立即把UI字符串绘制到 SDL 渲染器 (只能在主线程调用，由 Renderer::submitCommands 使用)。
+     * @param text UTF-8 字符串内容 (不要求以 '\0' 结尾)。
+     * @param fontID 字体 ID。
+     * @param fontSize 字体大小。
+     * @param position 左上角屏幕位置。
+     * @param color 文本颜色。
+     */
+    void renderUIText(std::string_view text, std::string_view fontID, int fontSize, const glm::vec2 &position, const utils::FColor &color);
+
     /**
      * @brief 绘制地图上的字符串。
      * @param camera 相机
@@ -60,7 +79,7 @@ class TextRenderer final {
     void drawText(const Camera &camera, std::string_view text, std::string_view fontID, int fontSize, const glm::vec2 &position, const utils::FColor &color = {1.0f, 1.0f, 1.0f, 1.0f});
 
     /**
-     * @brief 获取文本的尺寸。
+     * @brief 获取文本的尺寸 (可在任意线程调用)。
      * @param text 要测量的文本。
      * @param fontID 字体 ID。
      * @param fontSize 字体大小。
@@ -1,8 +1,10 @@
 #include "FontManager.hpp"
+#include "../debug/Trace.hpp"
 
 #include <SDL3_ttf/SDL_ttf.h>
 #include <spdlog/spdlog.h>
 
+#include <mutex>
 #include <stdexcept>
 #include <utility>
 
@@ -39,12 +41,14 @@ FontManager::~FontManager() {
 /// @name loader / unloader / getter
 /// @{
 TTF_Font *FontManager::loadFont(const std::string_view path, int size) {
+    ENGINE_TRACE_ZONE("FontManager::loadFont");
     if (size <= 0) {
         spdlog::error("RESOURCEMANAGER::FONTMANAGER::loadFont::无法加载字体\"{}\": 无效的字体大小: {}", path, size);
         return nullptr;
     }
     FontKey key(std::string(path), size);
 
+    std::unique_lock lock(m_mutex);
     auto it = m_fonts.find(key);
     if (it != m_fonts.end()) {
         spdlog::warn("RESOURCEMANAGER::FONTMANAGER::loadFont::字体\"{}\"已存在", path);
@@ -62,10 +66,13 @@ TTF_Font *FontManager::loadFont(const std::string_view path, int size) {
 }
 
 TTF_Font *FontManager::getFont(const std::string_view path, int size) {
-    FontKey key = {std::string(path), size};
-    auto it = m_fonts.find(key);
-    if (it != m_fonts.end()) {
-        return it->second.get();
+    {
+        FontKey key = {std::string(path), size};
+        std::shared_lock lock(m_mutex);
+        auto it = m_fonts.find(key);
+        if (it != m_fonts.end()) {
+            return it->second.get();
+        }
     }
     spdlog::error("RESOURCEMANAGER::FONTMANAGER::getFont::字体\"{}\"({}pt)不存在, 尝试加载", path, size);
     return loadFont(path, size);
@@ -73,6 +80,7 @@ TTF_Font *FontManager::getFont(const std::string_view path, int size) {
 
 void FontManager::unloadFont(const std::string_view path, int size) {
     FontKey key = {std::string(path), size};
+    std::unique_lock lock(m_mutex);
     auto it = m_fonts.find(key);
     if (it != m_fonts.end()) {
         spdlog::debug("RESOURCEMANAGER::FONTMANAGER::unloadFont::字体\"{}\"({}pt)已卸载", path, size);
@@ -83,6 +91,7 @@ void FontManager::unloadFont(const std::string_view path, int size) {
 }
 
 void FontManager::clearFonts() {
+    std::unique_lock lock(m_mutex);
     if (!m_fonts.empty()) {
         spdlog::debug("RESOURCEMANAGER::FONTMANAGER::clearFonts::所有 {} 个字体已卸载", m_fonts.size());
         m_fonts.clear();
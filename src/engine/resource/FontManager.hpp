@@ -1,6 +1,7 @@
 #pragma once
 #include <functional>
 #include <memory>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -22,6 +23,8 @@ struct FontKeyHash {
 /**
  * @class FontManager
  * @brief 字体管理器
+ * @note 线程安全：字体表由互斥锁保护，模拟线程 (测量文本) 与主线程 (绘制文本) 可以同时查找 / 加载字体。
+ *       同一个 TTF_Font 的使用 (测量、绘制) 由 TextRenderer 串行化
  */
 class FontManager final {
     friend class ResourceManager;
@@ -37,6 +40,8 @@ class FontManager final {
     };
 
     std::unordered_map<FontKey, std::unique_ptr<TTF_Font, SDLFontDeleter>, FontKeyHash> m_fonts; ///< @brief 字体映射表
+    mutable std::shared_mutex m_mutex;                                                            ///< @brief 保护 m_fonts
+
   public:
     FontManager();
     ~FontManager();
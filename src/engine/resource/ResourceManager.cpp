@@ -25,6 +25,7 @@ void ResourceManager::clear() {
 /// @name --- Texture ---
 /// @{
 SDL_Texture *ResourceManager::loadTexture(const std::string_view path) { return m_textureManager->loadTexture(path); }
+bool ResourceManager::preloadTexture(const std::string_view path) { return m_textureManager->preloadTexture(path); }
 SDL_Texture *ResourceManager::getTexture(const std::string_view path) { return m_textureManager->getTexture(path); }
 glm::vec2 ResourceManager::getTextureSize(const std::string_view path) { return m_textureManager->getTextureSize(path); }
 void ResourceManager::unloadTexture(const std::string_view path) { m_textureManager->unloadTexture(path); }
@@ -52,6 +52,7 @@ class ResourceManager final {
     /// @name --- Texture ---
     /// @{
     SDL_Texture *loadTexture(const std::string_view path);
+    bool preloadTexture(const std::string_view path); ///< @brief 只解码图像 (可在任意线程调用)，纹理在主线程第一次使用时上传
     SDL_Texture *getTexture(const std::string_view path);
     glm::vec2 getTextureSize(const std::string_view path);
     void unloadTexture(const std::string_view path);
@@ -1,8 +1,12 @@
 #include "TextureManager.hpp"
+#include "../debug/Trace.hpp"
 
+#include <mutex>
 #include <stdexcept>
 
+#include <SDL3/SDL_init.h>
 #include <SDL3/SDL_render.h>
+#include <SDL3/SDL_surface.h>
 #include <SDL3_image/SDL_image.h>
 #include <spdlog/spdlog.h>
 
@@ -12,6 +16,10 @@ void TextureManager::SDLTextureDeleter::operator()(SDL_Texture *texture) const {
     SDL_DestroyTexture(texture);
 }
 
+void TextureManager::SDLSurfaceDeleter::operator()(SDL_Surface *surface) const {
+    SDL_DestroySurface(surface);
+}
+
 TextureManager::TextureManager(SDL_Renderer *renderer) : m_renderer(renderer) {
     if (!m_renderer) {
         throw std::runtime_error("RESOURCEMANAGER::TEXTUREMANAGER::SDL_Renderer未初始化, 请检查是否正确初始化SDL");
@@ -28,36 +36,88 @@ TextureManager::~TextureManager() {
 /// @{
 
 SDL_Texture *TextureManager::loadTexture(const std::string_view path) {
+    ENGINE_TRACE_ZONE("TextureManager::loadTexture");
+    if (!SDL_IsMainThread()) {
+        preloadTexture(path); // 纹理只能在主线程创建
+        return nullptr;
+    }
+    std::unique_lock lock(m_mutex);
     auto it = m_textures.find(std::string(path));
     if (it != m_textures.end()) {
         spdlog::warn("RESOURCEMANAGER::TEXTUREMANAGER::已存在同名纹理, 将使用原纹理");
         return it->second.get();
     }
-    SDL_Texture *rawTexture = IMG_LoadTexture(m_renderer, std::string(path).c_str());
-    // 载入纹理时，设置纹理缩放模式为最邻近插值(必不可少，否则TileLayer渲染中会出现边缘空隙/模糊)
-    if (!SDL_SetTextureScaleMode(rawTexture, SDL_SCALEMODE_NEAREST)) {
-        spdlog::warn("RESOURCEMANAGER::TEXTUREMANAGER::无法设置纹理缩放模式为最邻近插值");
+    // 已在其他线程解码的图像只需上传，不必再读文件
+    SDL_Texture *rawTexture = nullptr;
+    auto surfaceIt = m_surfaces.find(std::string(path));
+    if (surfaceIt != m_surfaces.end()) {
+        rawTexture = SDL_CreateTextureFromSurface(m_renderer, surfaceIt->second.get());
+        m_surfaces.erase(surfaceIt);
+    } else {
+        rawTexture = IMG_LoadTexture(m_renderer, std::string(path).c_str());
     }
     if (!rawTexture) {
         spdlog::error("RESOURCEMANAGER::TEXTUREMANAGER::loadTexture::加载纹理失败: {} : {}", path, SDL_GetError());
         return nullptr;
     }
+    // 载入纹理时，设置纹理缩放模式为最邻近插值(必不可少，否则TileLayer渲染中会出现边缘空隙/模糊)
+    if (!SDL_SetTextureScaleMode(rawTexture, SDL_SCALEMODE_NEAREST)) {
+        spdlog::warn("RESOURCEMANAGER::TEXTUREMANAGER::无法设置纹理缩放模式为最邻近插值");
+    }
     m_textures.emplace(path, std::unique_ptr<SDL_Texture, SDLTextureDeleter>(rawTexture));
     spdlog::debug("RESOURCEMANAGER::TEXTUREMANAGER::loadTexture::加载纹理成功: {}", path);
 
     return rawTexture;
 }
 
+bool TextureManager::preloadTexture(const std::string_view path) {
+    ENGINE_TRACE_ZONE("TextureManager::preloadTexture");
+    std::string key(path);
+    {
+        std::shared_lock lock(m_mutex);
+        if (m_textures.contains(key) || m_surfaces.contains(key)) return true;
+    }
+    // 解码不持有锁，主线程的渲染不会被阻塞
+    SDL_Surface *surface = IMG_Load(key.c_str());
+    if (!surface) {
+        spdlog::error("RESOURCEMANAGER::TEXTUREMANAGER::preloadTexture::解码图像失败: {} : {}", path, SDL_GetError());
+        return false;
+    }
+    std::unique_lock lock(m_mutex);
+    if (m_textures.contains(key) || m_surfaces.contains(key)) { // 解码期间其他线程已经加载
+        SDL_DestroySurface(surface);
+        return true;
+    }
+    m_surfaces.emplace(std::move(key), surface);
+    spdlog::debug("RESOURCEMANAGER::TEXTUREMANAGER::preloadTexture::解码图像成功: {}", path);
+    return true;
+}
+
 SDL_Texture *TextureManager::getTexture(const std::string_view path) {
-    auto it = m_textures.find(std::string(path));
-    if (it != m_textures.end()) {
-        return it->second.get();
+    {
+        std::shared_lock lock(m_mutex);
+        auto it = m_textures.find(std::string(path));
+        if (it != m_textures.end()) {
+            return it->second.get();
+        }
     }
     spdlog::warn("RESOURCEMANAGER::TEXTUREMANAGER::getTextureSize::未找到纹理, 尝试加载: {}", path);
     return loadTexture(path);
 }
 
 glm::vec2 TextureManager::getTextureSize(const std::string_view path) {
+    // 尺寸查询不需要纹理：非主线程只解码图像，用解码结果的尺寸
+    if (!SDL_IsMainThread() && !preloadTexture(path)) {
+        spdlog::error("RESOURCEMANAGER::TEXTUREMANAGER::getTextureSize::未找到纹理 \"{}\"", path);
+        return glm::vec2(0, 0);
+    }
+    {
+        std::shared_lock lock(m_mutex);
+        auto surfaceIt = m_surfaces.find(std::string(path));
+        if (surfaceIt != m_surfaces.end()) {
+            return glm::vec2(surfaceIt->second->w, surfaceIt->second->h);
+        }
+    }
     SDL_Texture *texture = getTexture(path);
     if (!texture) {
         spdlog::error("RESOURCEMANAGER::TEXTUREMANAGER::getTextureSize::未找到纹理 \"{}\"", path);
@@ -72,6 +132,8 @@ glm::vec2 TextureManager::getTextureSize(const std::string_view path) {
 }
 
 void TextureManager::unloadTexture(const std::string_view path) {
+    std::unique_lock lock(m_mutex);
+    m_surfaces.erase(std::string(path));
     auto it = m_textures.find(std::string(path));
     if (it != m_textures.end()) {
         m_textures.erase(it);
@@ -82,6 +144,8 @@ void TextureManager::unloadTexture(const std::string_view path) {
 }
 
 void TextureManager::clearTextures() {
+    std::unique_lock lock(m_mutex);
+    m_surfaces.clear();
     if (!m_textures.empty()) {
         m_textures.clear();
         spdlog::debug("RESOURCEMANAGER::TEXTUREMANAGER::clearTextures::正在清理 {} 个缓存的纹理...", m_textures.size());
@@ -1,5 +1,6 @@
 #pragma once
 #include <memory>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -8,6 +9,7 @@
 
 struct SDL_Texture;
 struct SDL_Renderer;
+struct SDL_Surface;
 
 namespace engine::resource {
 
@@ -16,6 +18,8 @@ namespace engine::resource {
  * @brief 纹理管理器，用于加载和管理纹理资源
  * @note 纹理管理器是单例模式，通过 ResourceManager 获取，不可直接访问
  * @note 纹理管理器使用智能指针管理纹理的生命周期
+ * @note 线程安全：SDL 纹理只能在主线程创建，其他线程 (后台加载场景、模拟线程) 请求的纹理只解码为 SDL_Surface，
+ *       尺寸查询直接使用解码结果，纹理在主线程第一次使用时再上传
  */
 class TextureManager final {
     friend class ResourceManager; // 友元类，允许 ResourceManager 访问私有成员
@@ -28,7 +32,13 @@ class TextureManager final {
     struct SDLTextureDeleter {
         void operator()(SDL_Texture *texture) const; // 定义删除器函数
     };
+    /// @brief SDL 表面的删除器
+    struct SDLSurfaceDeleter {
+        void operator()(SDL_Surface *surface) const;
+    };
     std::unordered_map<std::string, std::unique_ptr<SDL_Texture, SDLTextureDeleter>> m_textures = {};
+    std::unordered_map<std::string, std::unique_ptr<SDL_Surface, SDLSurfaceDeleter>> m_surfaces = {}; ///< @brief 已在其他线程解码、尚未上传的图像
+    mutable std::shared_mutex m_mutex;                                                                 ///< @brief 保护 m_textures 与 m_surfaces
     SDL_Renderer *m_renderer = nullptr;
 
   public:
@@ -52,9 +62,15 @@ class TextureManager final {
      * @brief 从文件加载纹理并存储在纹理管理器中
      * @param path 纹理文件的路径
      * @param name 纹理的名称
-     * @return 加载的纹理指针
+     * @return 加载的纹理指针；在非主线程调用时只解码图像，返回 nullptr
      */
     SDL_Texture *loadTexture(const std::string_view path);
+    /**
+     * @brief 只把图像解码为 SDL_Surface (可在任意线程调用，纹理在主线程第一次使用时上传)
+     * @param path 纹理文件的路径
+     * @return 是否解码成功 (已经加载过也返回 true)
+     */
+    bool preloadTexture(const std::string_view path);
     /**
      * @brief 从纹理管理器中获取纹理
      * @param name 纹理的名称
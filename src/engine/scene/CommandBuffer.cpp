@@ -0,0 +1,51 @@
+#include "CommandBuffer.hpp"
+
+#include <algorithm>
+
+namespace engine::scene {
+
+void CommandBuffer::spawn(Factory &&factory, engine::object::ObjectHandle spawner) {
+    record({CommandType::Spawn, spawner, std::move(factory), nullptr});
+}
+
+void CommandBuffer::spawn(std::unique_ptr<engine::object::GameObject> &&gameObject, engine::object::ObjectHandle spawner) {
+    spawn([gameObject = std::move(gameObject)](Scene &) mutable { return std::move(gameObject); }, spawner);
+}
+
+void CommandBuffer::destroy(engine::object::ObjectHandle target) {
+    record({CommandType::Destroy, target, nullptr, nullptr});
+}
+
+std::vector<CommandBuffer::Command> &CommandBuffer::beginExecute() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_executing.swap(m_commands);
+    }
+    // 稳定排序: 同一目标的命令保持记录顺序，空句柄 (INVALID_INDEX) 排在最后
+    std::stable_sort(m_executing.begin(), m_executing.end(), [](const Command &a, const Command &b) {
+        return a.target.index < b.target.index;
+    });
+    return m_executing;
+}
+
+void CommandBuffer::endExecute() {
+    m_executing.clear();
+}
+
+void CommandBuffer::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_commands.clear();
+    m_executing.clear();
+}
+
+size_t CommandBuffer::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_commands.size();
+}
+
+void CommandBuffer::record(Command &&command) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_commands.push_back(std::move(command));
+}
+
+} // namespace engine::scene
@@ -0,0 +1,107 @@
+#pragma once
+#include "../object/GameObject.hpp"
+#include "../object/ObjectHandle.hpp"
+#include "../utils/MoveOnlyFunction.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace engine::scene {
+class Scene;
+
+/**
+ * @brief 场景的结构性修改命令缓冲区 (生成 / 销毁对象、增删组件)
+ *
+ * 任何线程都可以在更新期间记录命令 (加锁追加)，由 Scene 在每次更新末尾的同步点一次性执行，
+ * 因此组件的 update 不会在遍历途中改变容器或其他对象的组件表，更新顺序与结构性修改互不影响。
+ * 对象与组件都在同步点构造：场景的内存池 (PoolAllocator / 对象池) 不是线程安全的，并行阶段只能记录工厂。
+ *
+ * 执行前按目标句柄的槽位索引稳定排序：同一对象的命令保持记录顺序 (并行阶段只为自身所属对象记录命令，
+ * 它们来自同一个线程)，不同对象之间的顺序与线程调度无关。生成命令按生成者排序，没有生成者的排在最后。
+ */
+class CommandBuffer final {
+  public:
+    /// @brief 命令类型
+    enum class CommandType : std::uint8_t {
+        Spawn,           ///< @brief 把新对象加入场景
+        Destroy,         ///< @brief 标记对象删除 (在同一同步点移除)
+        AddComponent,    ///< @brief 为对象添加组件
+        RemoveComponent, ///< @brief 移除对象的组件
+    };
+    /// @brief 生成对象的工厂，在同步点以所属场景调用 (可使用 createGameObject / acquireGameObject)，返回 nullptr 表示放弃生成
+    using Factory = engine::utils::MoveOnlyFunction<std::unique_ptr<engine::object::GameObject>(Scene &)>;
+    /// @brief 对目标对象执行的组件修改 (只要求可移动，构造参数可以是 unique_ptr 等只可移动类型)
+    using Edit = engine::utils::MoveOnlyFunction<void(engine::object::GameObject &)>;
+    /// @brief 一条命令
+    struct Command {
+        CommandType type = CommandType::Destroy; ///< @brief 命令类型
+        engine::object::ObjectHandle target;     ///< @brief 目标对象；Spawn 时为生成者 (可为空)，只用于排序
+        Factory factory;                         ///< @brief 构造待加入对象的工厂 (Spawn)
+        Edit edit;                               ///< @brief 对目标执行的组件修改 (AddComponent / RemoveComponent)
+    };
+
+  private:
+    mutable std::mutex m_mutex;       ///< @brief 保护 m_commands
+    std::vector<Command> m_commands;  ///< @brief 正在记录的命令
+    std::vector<Command> m_executing; ///< @brief 正在执行的一批命令 (执行期间记录的命令进入下一批)
+
+  public:
+    CommandBuffer() = default;
+    ~CommandBuffer() = default;
+
+    CommandBuffer(const CommandBuffer &) = delete;
+    CommandBuffer &operator=(const CommandBuffer &) = delete;
+    CommandBuffer(CommandBuffer &&) = delete;
+    CommandBuffer &operator=(CommandBuffer &&) = delete;
+
+    /**
+     * @brief 记录生成命令，对象由工厂在同步点构造，随后加入场景并分配句柄 (可在任意线程调用)
+     * @param factory 工厂，捕获的参数按值保存 (可只可移动)
+     * @param spawner 生成者句柄，用于确定同一批生成命令的顺序 (并行阶段生成时应传入所属对象的句柄)
+     */
+    void spawn(Factory &&factory, engine::object::ObjectHandle spawner = {});
+    /**
+     * @brief 记录生成命令，加入一个已构造的对象
+     * @param gameObject 新对象，来自 Scene::createGameObject / acquireGameObject
+     * @param spawner 生成者句柄
+     * @note 构造对象会访问非线程安全的内存池，只能在主线程的串行阶段使用；并行阶段请记录工厂
+     */
+    void spawn(std::unique_ptr<engine::object::GameObject> &&gameObject, engine::object::ObjectHandle spawner = {});
+    /// @brief 记录销毁命令 (同步点时对象已失效则忽略)
+    void destroy(engine::object::ObjectHandle target);
+
+    /**
+     * @brief 记录添加组件命令，组件在同步点构造 (参数按值保存，可只可移动)
+     * @tparam T 组件类型
+     * @param target 目标对象
+     * @param args 组件构造函数参数
+     */
+    template <engine::object::ComponentClass T, typename... Args>
+    void addComponent(engine::object::ObjectHandle target, Args &&...args) {
+        record({CommandType::AddComponent, target, nullptr, [... args = std::forward<Args>(args)](engine::object::GameObject &gameObject) mutable {
+                    gameObject.addComponent<T>(std::move(args)...);
+                }});
+    }
+    /// @brief 记录移除组件命令
+    template <engine::object::ComponentClass T>
+    void removeComponent(engine::object::ObjectHandle target) {
+        record({CommandType::RemoveComponent, target, nullptr, [](engine::object::GameObject &gameObject) { gameObject.removeComponent<T>(); }});
+    }
+
+    /**
+     * @brief 取出已记录的命令并排序 (由 Scene 在同步点调用，之后必须调用 endExecute)
+     * @return 本批命令，执行期间新记录的命令留到下一批
+     */
+    std::vector<Command> &beginExecute();
+    void endExecute();   ///< @brief 清空本批命令 (保留容量)
+    void clear();        ///< @brief 丢弃所有命令 (场景清理时调用)
+    size_t size() const; ///< @brief 获取正在记录的命令数量
+
+  private:
+    void record(Command &&command); ///< @brief 加锁追加一条命令
+};
+
+} // namespace engine::scene
@@ -6,6 +6,8 @@
 #include "../component/TilelayerComponent.hpp"
 #include "../component/TransformComponent.hpp"
 #include "../core/Context.hpp"
+#include "../debug/Trace.hpp"
+#include "../ecs/EntityFactory.hpp"
 #include "../object/GameObject.hpp"
 #include "../object/ObjectBuilder.hpp"
 #include "../render/Animation.hpp"
@@ -18,9 +20,20 @@
 #include <filesystem>
 #include <fstream>
 #include <memory>
+#include <string_view>
 
 namespace engine::scene {
 
+namespace {
+/// @brief 按图层名称前缀选择渲染图层 ("ground*" / "deco*" / "fg*")，其余使用 fallback
+engine::render::RenderLayer getRenderLayerByName(std::string_view layerName, engine::render::RenderLayer fallback) {
+    if (layerName.starts_with("ground")) return engine::render::RenderLayer::Ground;
+    if (layerName.starts_with("deco")) return engine::render::RenderLayer::Deco;
+    if (layerName.starts_with("fg")) return engine::render::RenderLayer::ForegroundTile;
+    return fallback;
+}
+} // namespace
+
 LevelLoader::~LevelLoader() = default;
 
 LevelLoader::LevelLoader(engine::core::Context &context) : m_objectBuilder(std::make_unique<engine::object::ObjectBuilder>(*this, context)) {
@@ -32,6 +45,7 @@ void LevelLoader::setObjectBuilder(std::unique_ptr<engine::object::ObjectBuilder
 }
 
 bool LevelLoader::loadLevel(std::string_view levelPath, Scene &scene) {
+    ENGINE_TRACE_ZONE("LevelLoader::loadLevel");
     // 1. 加载 JSON 文件
     auto path = std::filesystem::path(levelPath);
     std::ifstream file(path);
@@ -93,6 +107,7 @@ bool LevelLoader::loadLevel(std::string_view levelPath, Scene &scene) {
 }
 
 void LevelLoader::loadImageLayer(const nlohmann::json &layerJson, Scene &scene) {
+    ENGINE_TRACE_ZONE("LevelLoader::loadImageLayer");
     // 获取纹理相对路径 （会自动处理'\/'符号）
     // json.value()返回的是一个临时对象，需要赋值才能保存，不能直接使用std::string_view
     std::string imagePath = layerJson.value("image", "");
@@ -112,7 +127,7 @@ void LevelLoader::loadImageLayer(const nlohmann::json &layerJson, Scene &scene)
     /*  可用类似方法获取其它各种属性，这里我们暂时用不上 */
 
     // 创建游戏对象
-    auto gameObject = std::make_unique<engine::object::GameObject>(layerName);
+    auto gameObject = scene.createGameObject(layerName);
     // 依次添加Transform，Parallax组件
     gameObject->addComponent<engine::component::TransformComponent>(offset);
     gameObject->addComponent<engine::component::ParallaxComponent>(textureID, scrollFactor, repeat);
@@ -122,6 +137,7 @@ void LevelLoader::loadImageLayer(const nlohmann::json &layerJson, Scene &scene)
 }
 
 void LevelLoader::loadTileLayer(const nlohmann::json &layerJson, Scene &scene) {
+    ENGINE_TRACE_ZONE("LevelLoader::loadTileLayer");
     if (!layerJson.contains("data") || !layerJson["data"].is_array()) {
         spdlog::error("LEVELLOADER::loadTileLayer::图层 '{}' 缺少 'data' 属性", layerJson.value("name", "Unnamed"));
         return;
@@ -140,22 +156,34 @@ void LevelLoader::loadTileLayer(const nlohmann::json &layerJson, Scene &scene) {
 
     // 获取图层名称
     std::string layerName = layerJson.value("name", "Unnamed");
+    auto renderLayer = getRenderLayerByName(layerName, engine::render::RenderLayer::Ground);
+    if (m_useEntities) {
+        // 创建为 ECS 实体，由 ecs::renderTileLayers 渲染
+        auto factory = scene.createEntityFactory();
+        factory.addTileLayer(factory.create(layerName), m_tileSize, m_mapSize, std::move(tiles)).layer = renderLayer;
+        spdlog::info("LEVELLOADER::loadTileLayer::加载瓦片图层 (实体): '{}' 完成", layerName);
+        return;
+    }
     // 创建游戏对象
-    auto gameObject = std::make_unique<engine::object::GameObject>(layerName);
+    auto gameObject = scene.createGameObject(layerName);
     // 添加Tilelayer组件
-    gameObject->addComponent<engine::component::TileLayerComponent>(m_tileSize, m_mapSize, std::move(tiles));
+    gameObject->addComponent<engine::component::TileLayerComponent>(m_tileSize, m_mapSize, std::move(tiles))->setLayer(renderLayer);
     // 添加到场景中
     scene.addGameObject(std::move(gameObject));
     spdlog::info("LEVELLOADER::loadTileLayer::加载瓦片图层: '{}' 完成", layerName);
 }
 
 void LevelLoader::loadObjectLayer(const nlohmann::json &layerJson, Scene &scene) {
+    ENGINE_TRACE_ZONE("LevelLoader::loadObjectLayer");
     if (!layerJson.contains("objects") || !layerJson["objects"].is_array()) {
         spdlog::error("对象图层 '{}' 缺少 'objects' 属性。", layerJson.value("name", "Unnamed"));
         return;
     }
+    // 图片对象默认与单位一起按 Y 排序，"deco*" 图层的对象始终绘制在单位之下
+    auto renderLayer = getRenderLayerByName(layerJson.value("name", ""), engine::render::RenderLayer::Units);
     // 获取对象数据
     const auto &objects = layerJson["objects"];
+    m_objectBuilder->setScene(&scene); // 对象及其组件从场景的内存池分配
     // 遍历对象数据
     for (const auto &object : objects) {
         // 获取对象gid
@@ -178,6 +206,7 @@ void LevelLoader::loadObjectLayer(const nlohmann::json &layerJson, Scene &scene)
         auto game_object = m_objectBuilder->getGameObject();
         // 添加到场景中
         if (game_object) {
+            if (auto *sprite = game_object->getComponent<engine::component::SpriteComponent>()) sprite->setLayer(renderLayer);
             spdlog::info("LEVELLOADER::loadObjectLayer::加载对象: '{}' 完成", game_object->getName());
             scene.addGameObject(std::move(game_object));
         }
@@ -398,6 +427,7 @@ std::optional<nlohmann::json> LevelLoader::getTileJsonByGid(int gid) const {
 }
 
 void LevelLoader::loadTileset(std::string_view tilesetPath, int firstGid) {
+    ENGINE_TRACE_ZONE("LevelLoader::loadTileset");
     auto path = std::filesystem::path(tilesetPath);
     std::ifstream tilesetFile(path);
     if (!tilesetFile.is_open()) {
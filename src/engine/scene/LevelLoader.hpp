@@ -37,12 +37,14 @@ class LevelLoader final {
     glm::ivec2 m_tileSize;                                          ///< @brief 瓦片尺寸(像素)
     std::map<int, nlohmann::json> m_tilesetData;                    ///< @brief firstgid -> 瓦片集数据
     std::unique_ptr<engine::object::ObjectBuilder> m_objectBuilder; ///< @brief 对象构建器
+    bool m_useEntities = false;                                     ///< @brief 瓦片层是否创建为 ECS 实体 (而不是 GameObject)
 
   public:
     LevelLoader(engine::core::Context &context);
     ~LevelLoader();
 
     void setObjectBuilder(std::unique_ptr<engine::object::ObjectBuilder> objectBuilder);
+    void setUseEntities(bool useEntities) { m_useEntities = useEntities; } ///< @brief 设置瓦片层是否创建为 ECS 实体
 
     /**
      * @brief 加载关卡数据到指定的 Scene 对象中。
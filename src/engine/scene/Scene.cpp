@@ -1,20 +1,37 @@
 #include "Scene.hpp"
+#include "CommandBuffer.hpp"
 #include "../UI/UIManager.hpp"
 #include "../core/Context.hpp"
 #include "../core/GameState.hpp"
+#include "../core/JobSystem.hpp"
+#include "../debug/Trace.hpp"
+#include "../ecs/EntityFactory.hpp"
+#include "../ecs/Systems.hpp"
+#include "../component/TransformComponent.hpp"
 #include "../object/GameObject.hpp"
+#include "../object/ObjectArena.hpp"
 #include "../render/Camera.hpp"
 #include "../utils/Events.hpp"
+#include "../utils/SwapRemove.hpp"
 
+#include <entt/core/hashed_string.hpp>
+#include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
 #include <spdlog/spdlog.h>
 
-#include <algorithm>
+#include <optional>
+#include <utility>
 
 namespace engine::scene {
 
+namespace {
+constexpr size_t PARALLEL_UPDATE_CHUNK_SIZE = 64; // 并行更新时每个任务处理的对象数
+} // namespace
+
 Scene::Scene(std::string_view name, engine::core::Context &context)
-    : m_sceneName(name), m_context(context), m_isInitialized(false), m_UIManager(std::make_unique<engine::ui::UIManager>()) {
+    : m_sceneName(name), m_context(context), m_isInitialized(false), m_UIManager(std::make_unique<engine::ui::UIManager>()),
+      m_arena(std::make_unique<engine::object::ObjectArena>()), m_commandBuffer(std::make_unique<CommandBuffer>()),
+      m_registry(std::make_unique<entt::registry>()) {
     spdlog::trace("SCENE::\"{}\"场景构造完成", m_sceneName);
 }
 
@@ -27,55 +44,92 @@ void Scene::init() {
     spdlog::trace("SCENE::init::\"{}\"场景初始化完成", m_sceneName);
 }
 void Scene::update(float deltaTime) {
+    ENGINE_TRACE_ZONE("Scene::update");
     if (!m_isInitialized) return;
+    saveMovedPositions();
 
-    // 只有游戏进行中，才需要更新相机
+    // 只有游戏进行中，才需要更新相机 (跟随目标只由它所在的场景通过句柄解析，目标已被移除时不再跟随)
     if (m_context.getGameState().isPlaying()) {
-        m_context.getCamera().update(deltaTime);
+        auto &camera = m_context.getCamera();
+        std::optional<glm::vec2> targetPosition;
+        auto *target = camera.getTargetScene() == this ? getGameObject(camera.getTarget()) : nullptr;
+        if (target) {
+            if (auto *transform = target->getComponent<engine::component::TransformComponent>()) {
+                targetPosition = transform->getPosition();
+            }
+        }
+        camera.update(deltaTime, targetPosition);
     }
 
-    for (auto it = m_gameObjects.begin(); it != m_gameObjects.end();) {
-        if (*it && !(*it)->isNeedRemove()) {
-            (*it)->update(deltaTime, m_context);
-            ++it;
-        } else {
-            if (*it) (*it)->clean();
-            it = m_gameObjects.erase(it);
+    // 只遍历有组件需要更新的对象，静态装饰物不会被访问
+    if (m_parallelUpdate) {
+        updateGameObjectsParallel(deltaTime);
+    } else {
+        for (auto *gameObject : m_updateObjects) {
+            if (!gameObject->isNeedRemove()) {
+                gameObject->update(deltaTime, m_context);
+            }
         }
     }
+    updateEntities(deltaTime);
     m_UIManager->update(deltaTime, m_context);
-    processPendingAdditions();
+
+    // 同步点: 本次更新记录的生成 / 销毁 / 组件增删一次性执行，然后移除对象、刷新活跃列表
+    applyCommands();
+    removeMarkedGameObjects();
+    applyActivityChanges();
+    compactActiveLists();
 }
 void Scene::render() {
+    ENGINE_TRACE_ZONE("Scene::render");
     if (!m_isInitialized) return;
     for (auto &gameObject : m_gameObjects) {
         gameObject->render(m_context);
     }
+    engine::ecs::renderTileLayers(*m_registry, m_context);
+    engine::ecs::renderSprites(*m_registry, m_context);
     m_UIManager->render(m_context);
 }
 
 void Scene::handleInput() {
+    ENGINE_TRACE_ZONE("Scene::handleInput");
     if (!m_isInitialized) return;
 
     if (m_UIManager->handleInput(m_context)) return; // UIManager处理了输入，则直接返回
 
-    for (auto it = m_gameObjects.begin(); it != m_gameObjects.end();) {
-        if (*it && !(*it)->isNeedRemove()) {
-            (*it)->handleInput(m_context);
-            ++it;
-        } else {
-            if (*it) (*it)->clean();
-            it = m_gameObjects.erase(it);
+    // 被标记删除的对象留到 update 末尾统一移除
+    for (auto *gameObject : m_inputObjects) {
+        if (!gameObject->isNeedRemove()) {
+            gameObject->handleInput(m_context);
         }
     }
 }
 
 void Scene::clean() {
+    ENGINE_TRACE_ZONE("Scene::clean");
     if (!m_isInitialized) return;
     for (auto &gameObject : m_gameObjects) {
+        unregisterHandle(*gameObject);
         gameObject->clean();
     }
+    for (auto &[poolKey, pool] : m_objectPools) {
+        for (auto &gameObject : pool) {
+            gameObject->clean();
+        }
+    }
     m_gameObjects.clear();
+    m_commandBuffer->clear(); // 尚未加入场景的对象没有句柄，直接析构
+    m_objectPools.clear();
+    m_nameIndex.clear();
+    m_tagIndex.clear();
+    m_updateObjects.clear();
+    m_inputObjects.clear();
+    m_isActiveListDirty = false;
+    m_activityChanges.clear();
+    m_movedObjects.clear();
+    m_registry->clear();
+    if (m_context.getCamera().getTargetScene() == this) m_context.getCamera().clearTarget(); // 之后可能有新场景复用同一地址
+    m_arena->release(); // 对象已全部析构 (块回到空闲链表)，整块释放内存池
     m_isInitialized = false;
     spdlog::trace("SCENE::clean::\"{}\"场景清理完成", m_sceneName);
 }
@@ -83,16 +137,37 @@ void Scene::clean() {
 
 /// @name 游戏对象管理
 /// @{
+std::unique_ptr<engine::object::GameObject> Scene::createGameObject(std::string_view name, std::string_view tag) {
+    std::unique_ptr<engine::object::GameObject> gameObject(m_arena->create<engine::object::GameObject>(name, tag));
+    gameObject->setArena(m_arena.get());
+    return gameObject;
+}
+std::unique_ptr<engine::object::GameObject> Scene::acquireGameObject(std::string_view poolKey) {
+    auto it = m_objectPools.find(entt::hashed_string::value(poolKey.data(), poolKey.size()));
+    if (it == m_objectPools.end() || it->second.empty()) return nullptr;
+    auto gameObject = std::move(it->second.back());
+    it->second.pop_back(); // 不缩容，稳定的波次中池的容量不再变化
+    return gameObject;
+}
+size_t Scene::getPooledObjectCount() const {
+    size_t count = 0;
+    for (const auto &[poolKey, pool] : m_objectPools) {
+        count += pool.size();
+    }
+    return count;
+}
 void Scene::addGameObject(std::unique_ptr<engine::object::GameObject> &&gameObject) {
-    if (gameObject)
+    if (gameObject) {
+        registerHandle(*gameObject);
+        indexGameObject(*gameObject);
         m_gameObjects.push_back(std::move(gameObject));
-    else
+    } else
         spdlog::warn("SCENE::addGameObject::WARN::\"{}\"场景添加游戏对象失败: 空游戏对象", m_sceneName);
 }
 void Scene::safeAddGameObject(std::unique_ptr<engine::object::GameObject> &&gameObject) {
-    if (gameObject)
-        m_pendingAdditions.push_back(std::move(gameObject));
-    else
+    if (gameObject) {
+        m_commandBuffer->spawn(std::move(gameObject)); // 句柄在本次更新末尾加入容器时分配
+    } else
         spdlog::warn("SCENE::safeAddGameObject::WARN::\"{}\"场景安全添加游戏对象失败: 空游戏对象", m_sceneName);
 }
 void Scene::removeGameObject(engine::object::GameObject *gameObjectPtr) {
@@ -100,28 +175,78 @@ void Scene::removeGameObject(engine::object::GameObject *gameObjectPtr) {
         spdlog::warn("SCENE::removeGameObject::WARN::\"{}\"场景移除游戏对象失败: 空游戏对象指针", m_sceneName);
         return;
     }
-    auto it = std::remove_if(m_gameObjects.begin(), m_gameObjects.end(), [gameObjectPtr](const std::unique_ptr<object::GameObject> &p) {
-        return p.get() == gameObjectPtr;
-    });
-    if (it != m_gameObjects.end()) {
-        (*it)->clean();
-        m_gameObjects.erase(it, m_gameObjects.end());
-        spdlog::trace("SCENE::removeGameObject::\"{}\"场景移除游戏对象成功: {}", m_sceneName, gameObjectPtr->getName());
-    } else {
-        spdlog::warn("SCENE::removeGameObject::WARN::\"{}\"场景移除游戏对象失败: 未找到游戏对象", m_sceneName);
-    }
+    // 只做标记，不扫描容器；对象在本次 (或下一次) update 末尾的压缩中被清理并析构
+    gameObjectPtr->setNeedRemove(true);
+    spdlog::trace("SCENE::removeGameObject::\"{}\"场景标记移除游戏对象: {}", m_sceneName, gameObjectPtr->getName());
 }
 void Scene::safeRemoveGameObject(engine::object::GameObject *gameObjectPtr) {
-    gameObjectPtr->setNeedRemove(true);
+    if (!gameObjectPtr) {
+        spdlog::warn("SCENE::safeRemoveGameObject::WARN::\"{}\"场景安全移除游戏对象失败: 空游戏对象指针", m_sceneName);
+        return;
+    }
+    m_commandBuffer->destroy(gameObjectPtr->getHandle());
+}
+void Scene::removeGameObjectByHandle(engine::object::ObjectHandle handle) {
+    if (auto *gameObject = getGameObject(handle)) removeGameObject(gameObject);
+}
+void Scene::safeRemoveGameObjectByHandle(engine::object::ObjectHandle handle) {
+    m_commandBuffer->destroy(handle); // 句柄在执行时解析，失效则忽略
+}
+engine::object::GameObject *Scene::getGameObject(engine::object::ObjectHandle handle) const {
+    const auto *slot = m_slots.get(handle);
+    if (!slot || !slot->object || slot->object->isNeedRemove()) return nullptr;
+    return slot->object;
 }
 engine::object::GameObject *Scene::findGameObjectByName(std::string_view name) const {
-    for (auto &gameObject : m_gameObjects) {
-        if (gameObject && gameObject->getName() == std::string(name)) {
-            return gameObject.get();
-        }
+    auto it = m_nameIndex.find(entt::hashed_string::value(name.data(), name.size()));
+    if (it == m_nameIndex.end()) return nullptr;
+    // 桶内逐个比较原字符串，排除哈希冲突
+    for (auto *gameObject : it->second) {
+        if (gameObject->getName() == name) return gameObject;
     }
     return nullptr;
 }
+const std::vector<engine::object::GameObject *> &Scene::getGameObjectsByTag(std::string_view tag) const {
+    static const std::vector<engine::object::GameObject *> EMPTY;
+    auto it = m_tagIndex.find(entt::hashed_string::value(tag.data(), tag.size()));
+    return it != m_tagIndex.end() ? it->second : EMPTY;
+}
+void Scene::setGameObjectName(engine::object::GameObject &gameObject, std::string_view name) {
+    auto handle = gameObject.getHandle();
+    if (handle.index >= m_slots.size() || m_slots[handle.index].object != &gameObject || !m_slots[handle.index].isIndexed) {
+        gameObject.setName(name); // 尚未加入容器，加入时再建立索引
+        return;
+    }
+    auto &slot = m_slots[handle.index];
+    if (slot.namePos != NOT_INDEXED) removeFromIndex(m_nameIndex, slot, &ObjectSlot::namePos, &ObjectSlot::nameKey);
+    gameObject.setName(name);
+    if (!name.empty()) addToIndex(m_nameIndex, name, &gameObject, &ObjectSlot::namePos, &ObjectSlot::nameKey);
+}
+void Scene::setGameObjectTag(engine::object::GameObject &gameObject, std::string_view tag) {
+    auto handle = gameObject.getHandle();
+    if (handle.index >= m_slots.size() || m_slots[handle.index].object != &gameObject || !m_slots[handle.index].isIndexed) {
+        gameObject.setTag(tag); // 尚未加入容器，加入时再建立索引
+        return;
+    }
+    auto &slot = m_slots[handle.index];
+    if (slot.tagPos != NOT_INDEXED) removeFromIndex(m_tagIndex, slot, &ObjectSlot::tagPos, &ObjectSlot::tagKey);
+    gameObject.setTag(tag);
+    if (!tag.empty()) addToIndex(m_tagIndex, tag, &gameObject, &ObjectSlot::tagPos, &ObjectSlot::tagKey);
+}
+
+engine::ecs::EntityFactory Scene::createEntityFactory() {
+    return engine::ecs::EntityFactory(*m_registry, m_context.getResourceManager());
+}
+void Scene::safeRemoveEntity(entt::entity entity) {
+    if (!m_registry->valid(entity)) {
+        spdlog::warn("SCENE::safeRemoveEntity::WARN::\"{}\"场景移除实体失败: 实体无效", m_sceneName);
+        return;
+    }
+    m_registry->emplace_or_replace<engine::ecs::NeedRemove>(entity);
+}
+size_t Scene::getEntityCount() const {
+    return m_registry->view<engine::ecs::Name>().size(); // EntityFactory 创建的实体都带有 Name
+}
 /// @}
 
 void Scene::requestPopScene() {
@@ -133,15 +258,240 @@ void Scene::requestPushScene(std::unique_ptr<engine::scene::Scene> &&scene) {
 void Scene::requestReplaceScene(std::unique_ptr<engine::scene::Scene> &&scene) {
     m_context.getDispatcher().trigger<engine::utils::ReplaceSceneEvent>(engine::utils::ReplaceSceneEvent{std::move(scene)});
 }
+void Scene::requestPreloadScene(std::unique_ptr<engine::scene::Scene> &&scene, bool replace) {
+    m_context.getDispatcher().trigger<engine::utils::PreloadSceneEvent>(engine::utils::PreloadSceneEvent{std::move(scene), replace});
+}
 void Scene::quit() {
     m_context.getDispatcher().trigger<engine::utils::QuitEvent>();
 }
 
-void Scene::processPendingAdditions() {
-    for (auto &gemeObject : m_pendingAdditions) {
-        m_gameObjects.push_back(std::move(gemeObject));
+void Scene::updateGameObjectsParallel(float deltaTime) {
+    // 1. 并行阶段: 每个任务处理一段连续的对象，只执行线程安全的组件 (不会写其他对象，也不会增删对象)
+    m_isInParallelPhase = true;
+    m_context.getJobSystem().parallelFor(m_updateObjects.size(), PARALLEL_UPDATE_CHUNK_SIZE, [this, deltaTime](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            auto *gameObject = m_updateObjects[i];
+            if (!gameObject->isNeedRemove()) {
+                gameObject->updateParallel(deltaTime, m_context);
+            }
+        }
+    });
+    m_isInParallelPhase = false;
+    // 2. 同步点: 串行执行其余组件 (在并行阶段或之前被标记删除的对象由 update 末尾统一移除)
+    for (auto *gameObject : m_updateObjects) {
+        if (!gameObject->isNeedRemove()) {
+            gameObject->updateSerial(deltaTime, m_context);
+        }
+    }
+}
+
+void Scene::removeMarkedGameObjects() {
+    ENGINE_TRACE_ZONE("Scene::removeMarkedGameObjects");
+    // 稳定压缩: 一次遍历把保留的对象依次前移，保持渲染顺序不变。
+    // 一帧内移除 k 个对象的代价为 O(n)，而逐个 erase 需要 O(k·n)
+    auto keep = m_gameObjects.begin();
+    for (auto it = m_gameObjects.begin(); it != m_gameObjects.end(); ++it) {
+        if (*it && !(*it)->isNeedRemove()) {
+            if (keep != it) *keep = std::move(*it);
+            ++keep;
+        } else if (*it) {
+            unregisterHandle(**it);
+            if (auto poolKey = (*it)->getPoolKey(); poolKey != 0) {
+                (*it)->reset(); // 保留组件，回收到对象池 (包括 AnimationComponent 一次性动画结束后移除的对象)
+                m_objectPools[poolKey].push_back(std::move(*it));
+            } else {
+                (*it)->clean(); // 对象在被覆盖或下面的 erase 时析构
+            }
+        }
+    }
+    m_gameObjects.erase(keep, m_gameObjects.end());
+}
+
+void Scene::updateEntities(float deltaTime) {
+    ENGINE_TRACE_ZONE("Scene::updateEntities");
+    // 并行更新的场景把纯数据系统也交给线程池分块执行
+    auto *jobSystem = m_parallelUpdate ? &m_context.getJobSystem() : nullptr;
+    engine::ecs::savePreviousPositions(*m_registry);
+    engine::ecs::updateAnimations(*m_registry, deltaTime, jobSystem);
+    engine::ecs::updateHealth(*m_registry, deltaTime, jobSystem);
+    engine::ecs::destroyMarkedEntities(*m_registry);
+}
+
+void Scene::registerHandle(engine::object::GameObject &gameObject) {
+    auto handle = m_slots.acquire();
+    m_slots[handle.index].object = &gameObject;
+    gameObject.setHandle(handle);
+    gameObject.setScene(this);
+}
+
+void Scene::unregisterHandle(engine::object::GameObject &gameObject) {
+    auto handle = gameObject.getHandle();
+    if (!m_slots.isValid(handle)) return; // 不属于本场景
+    unindexGameObject(m_slots[handle.index]);
+    m_slots.release(handle); // 槽位重置、代数加一，旧句柄 (包括 m_activityChanges 中残留的) 从此无法匹配
+    gameObject.setHandle({});
+    gameObject.setScene(nullptr);
+}
+
+void Scene::indexGameObject(engine::object::GameObject &gameObject) {
+    auto &slot = m_slots[gameObject.getHandle().index];
+    if (!gameObject.getName().empty()) addToIndex(m_nameIndex, gameObject.getName(), &gameObject, &ObjectSlot::namePos, &ObjectSlot::nameKey);
+    if (!gameObject.getTag().empty()) addToIndex(m_tagIndex, gameObject.getTag(), &gameObject, &ObjectSlot::tagPos, &ObjectSlot::tagKey);
+    slot.isIndexed = true;
+    // 加入场景时直接出现在当前位置，不从创建 / 回收时的位置插值过来
+    if (auto *transform = gameObject.getComponent<engine::component::TransformComponent>()) {
+        transform->resetInterpolation();
+    }
+    updateActivity(gameObject);
+}
+
+void Scene::unindexGameObject(ObjectSlot &slot) {
+    if (!slot.isIndexed) return;
+    if (slot.namePos != NOT_INDEXED) removeFromIndex(m_nameIndex, slot, &ObjectSlot::namePos, &ObjectSlot::nameKey);
+    if (slot.tagPos != NOT_INDEXED) removeFromIndex(m_tagIndex, slot, &ObjectSlot::tagPos, &ObjectSlot::tagKey);
+    if (slot.updatePos != NOT_INDEXED) removeFromActiveList(m_updateObjects, slot, &ObjectSlot::updatePos);
+    if (slot.inputPos != NOT_INDEXED) removeFromActiveList(m_inputObjects, slot, &ObjectSlot::inputPos);
+    slot.isIndexed = false;
+}
+
+void Scene::addToIndex(ObjectIndex &index, std::string_view key, engine::object::GameObject *gameObject, std::uint32_t ObjectSlot::*pos,
+                       entt::id_type ObjectSlot::*hash) {
+    auto &slot = m_slots[gameObject->getHandle().index];
+    slot.*hash = entt::hashed_string::value(key.data(), key.size());
+    auto &bucket = index[slot.*hash];
+    slot.*pos = static_cast<std::uint32_t>(bucket.size());
+    bucket.push_back(gameObject);
+}
+
+void Scene::removeFromIndex(ObjectIndex &index, ObjectSlot &slot, std::uint32_t ObjectSlot::*pos, entt::id_type ObjectSlot::*hash) {
+    // 按加入时的哈希查找：即使名称 / 标签被绕过 Scene 直接修改，也不会漏删而留下悬空指针
+    auto it = index.find(slot.*hash);
+    if (it == index.end()) return;
+    removeFromList(it->second, slot, pos);
+    if (it->second.empty()) index.erase(it);
+}
+
+void Scene::removeFromList(std::vector<engine::object::GameObject *> &list, ObjectSlot &slot, std::uint32_t ObjectSlot::*pos) {
+    // 与末尾交换后弹出，并更新被交换对象记录的位置
+    engine::utils::swapRemove(list, slot.*pos, [this, pos](engine::object::GameObject *moved, size_t movedPos) {
+        m_slots[moved->getHandle().index].*pos = static_cast<std::uint32_t>(movedPos);
+    });
+    slot.*pos = NOT_INDEXED;
+}
+
+void Scene::removeFromActiveList(std::vector<engine::object::GameObject *> &list, ObjectSlot &slot, std::uint32_t ObjectSlot::*pos) {
+    // 固定步长模拟依赖确定的更新顺序，不与末尾交换；空位只在同步点内存在，之后的遍历不会看到
+    list[slot.*pos] = nullptr;
+    slot.*pos = NOT_INDEXED;
+    m_isActiveListDirty = true;
+}
+
+void Scene::compactActiveLists() {
+    if (!m_isActiveListDirty) return;
+    auto compact = [this](std::vector<engine::object::GameObject *> &list, std::uint32_t ObjectSlot::*pos) {
+        size_t keep = 0;
+        for (auto *gameObject : list) {
+            if (!gameObject) continue;
+            m_slots[gameObject->getHandle().index].*pos = static_cast<std::uint32_t>(keep);
+            list[keep++] = gameObject;
+        }
+        list.resize(keep);
+    };
+    compact(m_updateObjects, &ObjectSlot::updatePos);
+    compact(m_inputObjects, &ObjectSlot::inputPos);
+    m_isActiveListDirty = false;
+}
+
+void Scene::onComponentsChanged(engine::object::GameObject &gameObject) {
+    auto handle = gameObject.getHandle();
+    if (handle.index >= m_slots.size() || m_slots[handle.index].object != &gameObject) return;
+    auto &slot = m_slots[handle.index];
+    // 尚未加入容器的对象在加入时判断；已记录的对象不重复记录
+    if (!slot.isIndexed || slot.isActivityDirty) return;
+    slot.isActivityDirty = true;
+    m_activityChanges.push_back(handle);
+}
+
+bool Scene::onTransformMoved(engine::object::GameObject &gameObject) {
+    auto handle = gameObject.getHandle();
+    if (handle.index >= m_slots.size() || m_slots[handle.index].object != &gameObject) return false;
+    const auto &slot = m_slots[handle.index];
+    if (!slot.isIndexed) return false;
+    if (slot.updatePos != NOT_INDEXED) return true; // 活跃对象在 GameObject::update 开头记录 (活跃列表只在同步点变化)
+    std::lock_guard<std::mutex> lock(m_movedMutex);
+    m_movedObjects.push_back(handle);
+    return true;
+}
+
+void Scene::saveMovedPositions() {
+    for (auto handle : m_movedObjects) {
+        auto *gameObject = getGameObject(handle);
+        if (!gameObject) continue; // 对象已被移除
+        if (auto *transform = gameObject->getComponent<engine::component::TransformComponent>()) {
+            transform->savePreviousPosition();
+        }
+    }
+    m_movedObjects.clear();
+}
+
+void Scene::applyActivityChanges() {
+    for (auto handle : m_activityChanges) {
+        auto &slot = m_slots[handle.index];
+        if (slot.generation != handle.generation || !slot.object) continue; // 对象已被移除
+        slot.isActivityDirty = false;
+        updateActivity(*slot.object);
+    }
+    m_activityChanges.clear();
+}
+
+void Scene::updateActivity(engine::object::GameObject &gameObject) {
+    auto &slot = m_slots[gameObject.getHandle().index];
+    bool needsUpdate = gameObject.needsUpdate();
+    if (needsUpdate && slot.updatePos == NOT_INDEXED) {
+        slot.updatePos = static_cast<std::uint32_t>(m_updateObjects.size());
+        m_updateObjects.push_back(&gameObject);
+    } else if (!needsUpdate && slot.updatePos != NOT_INDEXED) {
+        removeFromActiveList(m_updateObjects, slot, &ObjectSlot::updatePos);
+        // 移出活跃列表后不再在 update 开头记录插值起点，本次更新的移动由下一次更新开始时补记
+        if (gameObject.getComponent<engine::component::TransformComponent>()) {
+            m_movedObjects.push_back(gameObject.getHandle());
+        }
+    }
+    bool needsInput = gameObject.needsInput();
+    if (needsInput && slot.inputPos == NOT_INDEXED) {
+        slot.inputPos = static_cast<std::uint32_t>(m_inputObjects.size());
+        m_inputObjects.push_back(&gameObject);
+    } else if (!needsInput && slot.inputPos != NOT_INDEXED) {
+        removeFromActiveList(m_inputObjects, slot, &ObjectSlot::inputPos);
+    }
+}
+
+void Scene::applyCommands() {
+    ENGINE_TRACE_ZONE("Scene::applyCommands");
+    for (auto &command : m_commandBuffer->beginExecute()) {
+        if (command.type == CommandBuffer::CommandType::Spawn) {
+            auto gameObject = command.factory ? command.factory(*this) : nullptr; // 在同步点构造，内存池只在主线程访问
+            if (!gameObject) continue;
+            registerHandle(*gameObject);
+            indexGameObject(*gameObject);
+            m_gameObjects.push_back(std::move(gameObject));
+            continue;
+        }
+        auto *gameObject = getGameObject(command.target); // 已被移除或已标记删除的对象忽略
+        if (!gameObject) continue;
+        switch (command.type) {
+        case CommandBuffer::CommandType::Destroy:
+            gameObject->setNeedRemove(true);
+            break;
+        case CommandBuffer::CommandType::AddComponent:
+        case CommandBuffer::CommandType::RemoveComponent:
+            command.edit(*gameObject); // 组件增删会记录活跃状态变化，随后的 applyActivityChanges 处理
+            break;
+        default:
+            break;
+        }
     }
-    m_pendingAdditions.clear();
+    m_commandBuffer->endExecute();
 }
 
 } // namespace engine::scene
\ No newline at end of file
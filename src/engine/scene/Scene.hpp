@@ -1,7 +1,17 @@
 #pragma once
+#include "../object/HandleTable.hpp"
+#include "../object/ObjectHandle.hpp"
+
+#include <entt/core/fwd.hpp>
+#include <entt/entity/fwd.hpp>
+
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace engine::core {
@@ -14,26 +24,76 @@ class UIManager;
 
 namespace engine::object {
 class GameObject;
+class ObjectArena;
+} // namespace engine::object
+
+namespace engine::ecs {
+class EntityFactory;
 }
 
 namespace engine::scene {
 class SceneManager;
+class CommandBuffer;
 
 /**
  * @brief 场景基类，负责管理场景中的游戏对象和场景生命周期。
  *
  * 包含一组游戏对象，并提供更新、渲染、处理输入和清理的接口。
  * 派生类应实现具体的场景逻辑。
+ *
+ * 除 GameObject 外，场景还持有一个 entt::registry，数量巨大的实体 (单位、瓦片层等) 可以通过
+ * createEntityFactory() 创建为纯数据实体，由 ecs 系统函数批量更新和渲染 (例如 GameScene 的单位)。
+ * 渲染顺序: GameObject -> ECS 瓦片层 -> ECS 精灵 -> UI。
  */
 class Scene {
+  private:
+    static constexpr std::uint32_t NOT_INDEXED = UINT32_MAX; ///< @brief 对象不在该索引 / 列表中
+
+    /// @brief 句柄槽位：对象指针 + 当前代数 + 在名称 / 标签桶及活跃列表中的位置 (用于 O(1) 移除)
+    struct ObjectSlot {
+        engine::object::GameObject *object = nullptr;
+        std::uint32_t generation = 1;          ///< @brief 从 1 开始，默认构造的句柄 (代数 0) 永远无法匹配
+        std::uint32_t namePos = NOT_INDEXED;   ///< @brief 在名称桶中的下标
+        std::uint32_t tagPos = NOT_INDEXED;    ///< @brief 在标签桶中的下标
+        entt::id_type nameKey = 0;             ///< @brief 加入名称桶时的名称哈希 (移除时按它查找，不依赖对象当前的名称)
+        entt::id_type tagKey = 0;              ///< @brief 加入标签桶时的标签哈希
+        std::uint32_t updatePos = NOT_INDEXED; ///< @brief 在更新列表中的下标
+        std::uint32_t inputPos = NOT_INDEXED;  ///< @brief 在输入列表中的下标
+        bool isIndexed = false;                ///< @brief 对象是否已加入容器并建立索引
+        bool isActivityDirty = false;          ///< @brief 组件已变化，等待同步点重新判断是否活跃
+    };
+    /// @brief 哈希字符串 -> 对象列表 (桶内无序，移除时与末尾交换)
+    using ObjectIndex = std::unordered_map<entt::id_type, std::vector<engine::object::GameObject *>>;
+    /// @brief 对象池键 -> 已回收的对象
+    using ObjectPools = std::unordered_map<entt::id_type, std::vector<std::unique_ptr<engine::object::GameObject>>>;
+
   protected:
     std::string m_sceneName;                            ///< @brief 场景名称
     engine::core::Context &m_context;                   ///< @brief 上下文引用（隐式，构造时传入）
     std::unique_ptr<engine::ui::UIManager> m_UIManager; ///< @brief UI管理器(初始化时自动创建)
 
     bool m_isInitialized = false;                                                ///< @brief 场景是否已初始化(非当前场景很可能未被删除，因此需要初始化标志避免重复初始化)
+    bool m_parallelUpdate = false;                                               ///< @brief 是否把线程安全的组件更新分块并行执行
+    bool m_freezeWhenCovered = false;                                            ///< @brief 被其他场景覆盖时是否只绘制截图 (见 SceneManager::render)
+    std::unique_ptr<engine::object::ObjectArena> m_arena;                        ///< @brief 游戏对象及组件的内存池 (声明在对象容器之前，保证最后析构)
     std::vector<std::unique_ptr<engine::object::GameObject>> m_gameObjects;      ///< @brief 场景中的游戏对象
-    std::vector<std::unique_ptr<engine::object::GameObject>> m_pendingAdditions; ///< @brief 待添加的游戏对象（延时添加）
+    std::unique_ptr<CommandBuffer> m_commandBuffer;                              ///< @brief 延时执行的结构性修改 (生成 / 销毁对象、增删组件)
+    std::unique_ptr<entt::registry> m_registry;                                  ///< @brief ECS 实体及组件存储
+
+  private:
+    engine::object::HandleTable<ObjectSlot> m_slots;             ///< @brief 句柄槽位表 (索引即 ObjectHandle::index)
+    ObjectIndex m_nameIndex;                                     ///< @brief 名称索引 (只包含已加入容器、名称非空的对象)
+    ObjectIndex m_tagIndex;                                      ///< @brief 标签分组 (只包含已加入容器、标签非空的对象)
+    std::vector<engine::object::GameObject *> m_updateObjects;   ///< @brief 需要 update 的对象 (按加入顺序)，静态对象不在其中
+    std::vector<engine::object::GameObject *> m_inputObjects;    ///< @brief 需要 handleInput 的对象 (按加入顺序)
+    bool m_isActiveListDirty = false;                            ///< @brief 活跃列表中有被移除的空位，等待同步点压缩
+    bool m_isInParallelPhase = false;                            ///< @brief 是否处于并行更新阶段 (此时不能增删组件)
+    std::vector<engine::object::ObjectHandle> m_activityChanges; ///< @brief 组件发生变化、等待重新判断是否活跃的对象
+    std::vector<engine::object::ObjectHandle> m_movedObjects;    ///< @brief 位置被修改的非活跃对象，下一次更新开始时记录插值起点
+    std::mutex m_movedMutex;                                     ///< @brief 保护 m_movedObjects (并行更新阶段也可能移动对象)
+    ObjectPools m_objectPools;                                   ///< @brief 被移除的可回收对象 (设置了池键)，等待 acquireGameObject 复用
+    std::atomic<float> m_loadProgress = 0.0f;                    ///< @brief 后台准备进度 [0, 1] (加载线程写，主循环读)
+    std::atomic<bool> m_isPrepared = false;                      ///< @brief 后台准备是否完成
 
   public:
     /**
@@ -57,20 +117,94 @@ class Scene {
     virtual void render();                ///< @brief 渲染场景。
     virtual void handleInput();           ///< @brief 处理输入。
     virtual void clean();                 ///< @brief 清理场景。
+    /**
+     * @brief 后台准备场景 (由 SceneManager 在加载线程中调用，早于 init)
+     *
+     * 关卡 JSON 解析、纹理解码 (ResourceManager::preloadTexture / getTextureSize)、游戏对象与实体的创建都可以放在这里，
+     * init 只保留连接输入回调等轻量工作。此时场景尚未入栈：不能访问其他场景、触发事件或连接回调。
+     * 可以调用 setLoadProgress 报告进度，供当前场景显示。
+     */
+    virtual void prepare() {}
 
+    /**
+     * @brief 从场景的内存池中创建游戏对象 (其组件也从内存池分配)，创建后仍需 addGameObject / safeAddGameObject
+     * @param name 对象名称
+     * @param tag 对象标签
+     */
+    std::unique_ptr<engine::object::GameObject> createGameObject(std::string_view name = "", std::string_view tag = "");
+    /**
+     * @brief 从对象池中取出一个被回收的对象 (波次中的敌人、投射物、一次性特效等)
+     * @param poolKey 对象池键 (例如 "arrow")
+     * @return 回收的对象：组件已 reset，其余配置保持移除前的状态；池为空时返回 nullptr，
+     *         此时应通过 createGameObject 创建并 setPoolKey，使其移除后进入同一个池
+     * @note 取出后重新设置位置 (并调用 TransformComponent::resetInterpolation)，再 addGameObject / safeAddGameObject
+     */
+    std::unique_ptr<engine::object::GameObject> acquireGameObject(std::string_view poolKey);
+    size_t getPooledObjectCount() const; ///< @brief 获取所有对象池中等待复用的对象总数
     virtual void addGameObject(std::unique_ptr<engine::object::GameObject> &&gameObject);
+    /**
+     * @brief 记录生成命令，对象在本次更新的同步点加入场景并分配句柄
+     * @note 对象本身须在主线程创建 (createGameObject 非线程安全)；并行阶段请用 getCommandBuffer().spawn 记录工厂
+     */
     virtual void safeAddGameObject(std::unique_ptr<engine::object::GameObject> &&gameObject);
     virtual void removeGameObject(engine::object::GameObject *gameObjectPtr);
+    /// @brief 记录销毁命令，对象在本次更新的同步点被标记并移除 (可在任意线程调用)
     virtual void safeRemoveGameObject(engine::object::GameObject *gameObjectPtr);
+    // 句柄版本不与虚函数重载同名，派生类重写 removeGameObject / safeRemoveGameObject 时不会把它们隐藏
+    void removeGameObjectByHandle(engine::object::ObjectHandle handle);     ///< @brief 通过句柄移除游戏对象（句柄失效时忽略）
+    void safeRemoveGameObjectByHandle(engine::object::ObjectHandle handle); ///< @brief 通过句柄安全移除游戏对象（句柄失效时忽略）
+
+    /**
+     * @brief 通过句柄获取游戏对象 (O(1))
+     * @param handle 对象句柄
+     * @return 对象指针；对象已被移除、已标记删除或句柄为空时返回 nullptr
+     */
+    engine::object::GameObject *getGameObject(engine::object::ObjectHandle handle) const;
+    /// @brief 句柄指向的对象是否仍然存活
+    bool isAlive(engine::object::ObjectHandle handle) const { return getGameObject(handle) != nullptr; }
 
     /// @brief 获取场景中的游戏对象容器。
     const std::vector<std::unique_ptr<engine::object::GameObject>> &getGameObjects() const { return m_gameObjects; }
-    /// @brief 根据名称查找游戏对象（返回找到的第一个对象）。
+    /// @brief 根据名称查找游戏对象（哈希索引，O(1)；同名对象有多个时返回其中之一）。
     engine::object::GameObject *findGameObjectByName(std::string_view name) const;
+    /**
+     * @brief 获取某个标签分组中的所有游戏对象 (不遍历分组之外的对象)
+     * @param tag 标签
+     * @return 对象列表，可能包含已标记删除但尚未移除的对象 (需检查 isNeedRemove)。
+     *         遍历期间可以 safeAddGameObject 或标记删除，但不要 addGameObject 或修改标签
+     */
+    const std::vector<engine::object::GameObject *> &getGameObjectsByTag(std::string_view tag) const;
+    /// @brief 修改已加入场景的对象名称，并同步名称索引（直接调用 GameObject::setName 不会更新索引）
+    void setGameObjectName(engine::object::GameObject &gameObject, std::string_view name);
+    /// @brief 修改已加入场景的对象标签，并同步标签分组（直接调用 GameObject::setTag 不会更新索引）
+    void setGameObjectTag(engine::object::GameObject &gameObject, std::string_view tag);
+    /// @brief 对象增删组件后由 GameObject 调用，在本次更新的同步点把对象移入 / 移出活跃列表
+    void onComponentsChanged(engine::object::GameObject &gameObject);
+    /**
+     * @brief 对象位置被修改后由 TransformComponent 调用 (可在并行更新阶段调用)
+     * @return 对象已加入场景时返回 true：活跃对象在下一次 update 时、非活跃对象在下一次更新开始时记录插值起点
+     */
+    bool onTransformMoved(engine::object::GameObject &gameObject);
+    size_t getUpdateObjectCount() const { return m_updateObjects.size(); } ///< @brief 获取每帧实际更新的游戏对象数量
+    /// @brief 获取命令缓冲区，更新期间 (包括并行阶段) 的结构性修改都应记录在这里
+    CommandBuffer &getCommandBuffer() const { return *m_commandBuffer; }
+
+    /// @brief 创建绑定到本场景 registry 的实体工厂。
+    engine::ecs::EntityFactory createEntityFactory();
+    /// @brief 标记实体待删除（本次更新结束时销毁）。
+    void safeRemoveEntity(entt::entity entity);
+    /// @brief 获取场景中由 EntityFactory 创建的实体数量。
+    size_t getEntityCount() const;
 
     void requestPopScene();
     void requestPushScene(std::unique_ptr<engine::scene::Scene> &&scene);
     void requestReplaceScene(std::unique_ptr<engine::scene::Scene> &&scene);
+    /**
+     * @brief 请求在后台准备场景 (调用其 prepare)，完成后再压入或替换，期间当前场景照常运行
+     * @param scene 新场景
+     * @param replace 准备完成后替换所有场景 (true) 还是压入 (false)
+     */
+    void requestPreloadScene(std::unique_ptr<engine::scene::Scene> &&scene, bool replace = false);
     void quit();
 
     // getters and setters
@@ -78,12 +212,45 @@ class Scene {
     std::string_view getName() const { return m_sceneName; }                 ///< @brief 获取场景名称
     void setInitialized(bool initialized) { m_isInitialized = initialized; } ///< @brief 设置场景是否已初始化
     bool isInitialized() const { return m_isInitialized; }                   ///< @brief 获取场景是否已初始化
+    void setParallelUpdate(bool parallel) { m_parallelUpdate = parallel; }   ///< @brief 设置是否并行更新游戏对象
+    bool isParallelUpdate() const { return m_parallelUpdate; }               ///< @brief 获取是否并行更新游戏对象
+    bool isInParallelPhase() const { return m_isInParallelPhase; }           ///< @brief 获取是否处于并行更新阶段
+    void setFreezeWhenCovered(bool freeze) { m_freezeWhenCovered = freeze; } ///< @brief 设置被覆盖时是否冻结为截图
+    bool isFreezeWhenCovered() const { return m_freezeWhenCovered; }         ///< @brief 获取被覆盖时是否冻结为截图
+    void setPrepared(bool prepared) { m_isPrepared = prepared; }             ///< @brief 设置后台准备是否完成 (由 SceneManager 调用)
+    bool isPrepared() const { return m_isPrepared; }                         ///< @brief 获取后台准备是否完成
+    float getLoadProgress() const { return m_loadProgress; }                 ///< @brief 获取后台准备进度 [0, 1]
 
     engine::core::Context &getContext() const { return m_context; }                                      ///< @brief 获取上下文引用
     std::vector<std::unique_ptr<engine::object::GameObject>> &getGameObjects() { return m_gameObjects; } ///< @brief 获取场景中的游戏对象
+    entt::registry &getRegistry() const { return *m_registry; }                                          ///< @brief 获取 ECS registry
 
   protected:
-    void processPendingAdditions(); ///< @brief 处理待添加的游戏对象。（每轮更新的最后调用）
+    void setLoadProgress(float progress) { m_loadProgress = progress; } ///< @brief 报告后台准备进度 (在 prepare 中调用)
+
+    void applyCommands();                            ///< @brief 按顺序执行命令缓冲区中的所有命令 (每轮更新末尾的同步点调用)
+    void updateGameObjectsParallel(float deltaTime); ///< @brief 并行更新游戏对象（线程安全组件并行，其余组件在同步点串行）
+    void updateEntities(float deltaTime);            ///< @brief 运行 ECS 更新系统，并销毁被标记删除的实体
+    void removeMarkedGameObjects();                  ///< @brief 一次性移除所有被标记删除的游戏对象 (稳定压缩，保持顺序)，可回收的对象放入对象池
+    void applyActivityChanges();                     ///< @brief 把组件发生变化的对象移入 / 移出活跃列表 (同步点调用)
+    void saveMovedPositions();                       ///< @brief 为上一次更新中被移动的非活跃对象记录插值起点 (更新开始时调用)
+
+  private:
+    void registerHandle(engine::object::GameObject &gameObject);   ///< @brief 为对象分配句柄槽位
+    void unregisterHandle(engine::object::GameObject &gameObject); ///< @brief 释放对象的槽位，代数加一使旧句柄失效
+    void indexGameObject(engine::object::GameObject &gameObject);  ///< @brief 把对象加入名称索引和标签分组 (对象加入容器时调用)
+    void unindexGameObject(ObjectSlot &slot);                      ///< @brief 把对象从名称索引和标签分组中移除
+    /// @brief 把对象放入 key 对应的桶，并记录其在桶中的位置与 key 的哈希
+    void addToIndex(ObjectIndex &index, std::string_view key, engine::object::GameObject *gameObject, std::uint32_t ObjectSlot::*pos,
+                    entt::id_type ObjectSlot::*hash);
+    /// @brief 从加入时记录的哈希对应的桶中移除对象，并修正被交换对象的位置
+    void removeFromIndex(ObjectIndex &index, ObjectSlot &slot, std::uint32_t ObjectSlot::*pos, entt::id_type ObjectSlot::*hash);
+    /// @brief 从列表中移除对象 (与末尾交换后弹出)，并修正被交换对象记录的位置
+    void removeFromList(std::vector<engine::object::GameObject *> &list, ObjectSlot &slot, std::uint32_t ObjectSlot::*pos);
+    /// @brief 从更新 / 输入列表中移除对象：只留下空位，保持其余对象的更新顺序 (同步点末尾由 compactActiveLists 压缩)
+    void removeFromActiveList(std::vector<engine::object::GameObject *> &list, ObjectSlot &slot, std::uint32_t ObjectSlot::*pos);
+    void compactActiveLists(); ///< @brief 稳定压缩更新 / 输入列表中的空位，并修正对象记录的位置
+    void updateActivity(engine::object::GameObject &gameObject); ///< @brief 根据组件重新判断对象是否在更新 / 输入列表中
 };
 
 } // namespace engine::scene
\ No newline at end of file
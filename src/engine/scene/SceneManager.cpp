@@ -1,5 +1,7 @@
 #include "SceneManager.hpp"
 #include "../core/Context.hpp"
+#include "../debug/Trace.hpp"
+#include "../render/Renderer.hpp"
 #include "Scene.hpp"
 
 #include <entt/signal/dispatcher.hpp>
@@ -10,6 +12,7 @@ SceneManager::SceneManager(engine::core::Context &context) : m_context(context)
     m_context.getDispatcher().sink<engine::utils::PopSceneEvent>().connect<&SceneManager::onPopScene>(this);
     m_context.getDispatcher().sink<engine::utils::PushSceneEvent>().connect<&SceneManager::onPushScene>(this);
     m_context.getDispatcher().sink<engine::utils::ReplaceSceneEvent>().connect<&SceneManager::onReplaceScene>(this);
+    m_context.getDispatcher().sink<engine::utils::PreloadSceneEvent>().connect<&SceneManager::onPreloadScene>(this);
     spdlog::trace("SCENEMANAGER::场景管理器已创建");
 }
 
@@ -37,12 +40,31 @@ void SceneManager::update(float deltaTime) {
         currentScene->update(deltaTime);
     }
     processPendingActions(); // 处理挂起的操作
+    processLoadingScene();
 }
 
 void SceneManager::render() {
+    ENGINE_TRACE_ZONE("SceneManager::render");
+    auto &renderer = m_context.getRenderer();
     // 渲染时需要渲染所有场景，而不是只渲染当前场景
-    for (auto &scene : m_sceneStack) {
-        scene->render();
+    for (size_t i = 0; i < m_sceneStack.size(); ++i) {
+        auto &scene = m_sceneStack[i];
+        bool isCovered = i + 1 < m_sceneStack.size();
+        renderer.beginRenderPass(); // 每个场景一个批次，上层场景整体绘制在下层之上
+        if (!isCovered || !scene->isFreezeWhenCovered()) {
+            scene->render();
+            continue;
+        }
+        // 冻结的被覆盖场景: 第一次被覆盖时录制到截图，之后只绘制截图
+        auto [it, isNew] = m_snapshots.try_emplace(scene.get(), 0);
+        if (isNew) {
+            it->second = renderer.createCaptureTarget();
+            renderer.beginCapture(it->second);
+            scene->render();
+            renderer.endCapture();
+            spdlog::debug("SCENEMANAGER::render::场景 {} 被覆盖，冻结为截图", scene->getName());
+        }
+        renderer.drawCapture(it->second);
     }
 }
 
@@ -55,6 +77,11 @@ void SceneManager::handleInput() {
 
 void SceneManager::close() {
     spdlog::trace("SCENEMANAGER::close::关闭场景管理器并清理所有场景");
+    // 等待加载线程结束，准备中的场景尚未 init，直接销毁
+    if (m_loadingThread.joinable()) {
+        m_loadingThread.join();
+    }
+    m_loadingScene.reset();
     // 清理并移除所有场景 (从栈顶到栈底)
     while (!m_sceneStack.empty()) {
         if (m_sceneStack.back()) {
@@ -63,6 +90,7 @@ void SceneManager::close() {
         }
         m_sceneStack.pop_back();
     }
+    m_snapshots.clear(); // 截图纹理由 Renderer::clean 统一销毁
     m_context.getDispatcher().disconnect(this); // 断开所有连接
 }
 
@@ -80,7 +108,39 @@ void SceneManager::onReplaceScene(engine::utils::ReplaceSceneEvent &event) {
     m_pendingScene = std::move(event.scene);
 }
 
+void SceneManager::onPreloadScene(engine::utils::PreloadSceneEvent &event) {
+    if (!event.scene) {
+        spdlog::error("SCENEMANAGER::onPreloadScene::尝试准备空场景");
+        return;
+    }
+    if (m_loadingScene) {
+        spdlog::warn("SCENEMANAGER::onPreloadScene::场景 {} 仍在准备中，忽略场景 {}", m_loadingScene->getName(), event.scene->getName());
+        return;
+    }
+    spdlog::debug("SCENEMANAGER::onPreloadScene::开始后台准备场景: {}", event.scene->getName());
+    m_loadingScene = std::move(event.scene);
+    m_isLoadingReplace = event.replace;
+    m_loadingThread = std::thread([scene = m_loadingScene.get()] {
+        engine::debug::Trace::setThreadName("Scene Loader");
+        ENGINE_TRACE_ZONE("SceneManager::prepareScene");
+        scene->prepare();
+        scene->setPrepared(true); // 原子写，之后主循环才会读取场景数据
+    });
+}
+
+void SceneManager::processLoadingScene() {
+    if (!m_loadingScene || !m_loadingScene->isPrepared()) return;
+    m_loadingThread.join(); // 已准备完成，不会阻塞
+    spdlog::debug("SCENEMANAGER::processLoadingScene::场景准备完成: {}", m_loadingScene->getName());
+    if (m_isLoadingReplace) {
+        replaceScene(std::move(m_loadingScene));
+    } else {
+        pushScene(std::move(m_loadingScene));
+    }
+}
+
 void SceneManager::processPendingActions() {
+    ENGINE_TRACE_ZONE("SceneManager::processPendingActions");
     if (m_pendingAction == PendingAction::None) return;
 
     switch (m_pendingAction) {
@@ -100,6 +160,7 @@ void SceneManager::processPendingActions() {
 }
 
 void SceneManager::pushScene(std::unique_ptr<Scene> &&scene) {
+    ENGINE_TRACE_ZONE("SceneManager::pushScene");
     if (!scene) {
         spdlog::error("SCENEMANAGER::pushScene::尝试压入空场景");
         return;
@@ -114,6 +175,7 @@ void SceneManager::pushScene(std::unique_ptr<Scene> &&scene) {
 }
 
 void SceneManager::popScene() {
+    ENGINE_TRACE_ZONE("SceneManager::popScene");
     if (m_sceneStack.empty()) {
         spdlog::error("SCENEMANAGER::popScene::尝试弹出空场景栈");
         return;
@@ -122,14 +184,18 @@ void SceneManager::popScene() {
     if (m_sceneStack.back()) {
         m_sceneStack.back()->clean();
     }
+    discardSnapshot(m_sceneStack.back().get());
     m_sceneStack.pop_back(); // 弹出场景
     if (m_sceneStack.empty()) {
         spdlog::error("SCENEMANAGER::popScene::场景栈为空，退出程序");
         m_context.getDispatcher().trigger<engine::utils::QuitEvent>();
+        return;
     }
+    discardSnapshot(m_sceneStack.back().get()); // 回到栈顶的场景恢复实时渲染，下次被覆盖时重新截图
 }
 
 void SceneManager::replaceScene(std::unique_ptr<Scene> &&scene) {
+    ENGINE_TRACE_ZONE("SceneManager::replaceScene");
     if (!scene) {
         spdlog::error("SCENEMANAGER::replaceScene::尝试替换为空场景");
         return;
@@ -140,6 +206,7 @@ void SceneManager::replaceScene(std::unique_ptr<Scene> &&scene) {
         if (m_sceneStack.back()) {
             m_sceneStack.back()->clean();
         }
+        discardSnapshot(m_sceneStack.back().get());
         m_sceneStack.pop_back();
     }
     // 确保场景初始化
@@ -150,4 +217,11 @@ void SceneManager::replaceScene(std::unique_ptr<Scene> &&scene) {
     m_sceneStack.push_back(std::move(scene));
 }
 
+void SceneManager::discardSnapshot(const Scene *scene) {
+    auto it = m_snapshots.find(scene);
+    if (it == m_snapshots.end()) return;
+    m_context.getRenderer().releaseCaptureTarget(it->second); // 纹理只能在主线程销毁，随下一帧的命令一起释放
+    m_snapshots.erase(it);
+}
+
 } // namespace engine::scene
\ No newline at end of file
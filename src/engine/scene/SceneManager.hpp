@@ -5,8 +5,13 @@
 
 #pragma once
 #include "../utils/Events.hpp"
+
+#include <SDL3/SDL_stdinc.h>
+
 #include <memory>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 // 前置声明
@@ -25,6 +30,10 @@ namespace engine::scene {
  *
  * SceneManager 使用栈结构管理场景，支持场景的压入、弹出和替换操作。
  * 所有场景切换操作都是线程安全的，使用延时处理机制确保场景切换不会中断当前帧的渲染。
+ * 被覆盖 (不在栈顶) 且设置了 Scene::setFreezeWhenCovered 的场景只在第一次被覆盖时渲染一次到截图纹理，
+ * 之后每帧只绘制截图；重新回到栈顶时丢弃截图，恢复实时渲染。
+ * 通过 Scene::requestPreloadScene 请求的场景先在加载线程中执行 prepare()，期间当前场景照常运行，
+ * 准备完成后才压入或替换，场景切换时只剩 init() 的轻量工作。
  * 该类被声明为 final，禁止被继承。
  */
 class SceneManager final {
@@ -41,6 +50,12 @@ class SceneManager final {
     PendingAction m_pendingAction;         ///< 当前待处理的场景操作类型
     std::unique_ptr<Scene> m_pendingScene; ///< 待处理的新场景（用于Push和Replace操作）
 
+    std::unordered_map<const Scene *, Uint32> m_snapshots; ///< 被覆盖场景的截图渲染目标ID
+
+    std::unique_ptr<Scene> m_loadingScene; ///< 正在后台准备的场景 (同一时间只有一个)
+    std::thread m_loadingThread;           ///< 执行 Scene::prepare 的加载线程
+    bool m_isLoadingReplace = false;       ///< 准备完成后替换所有场景 (true) 还是压入 (false)
+
   public:
     explicit SceneManager(engine::core::Context &context);
     ~SceneManager();
@@ -51,6 +66,8 @@ class SceneManager final {
     SceneManager &operator=(SceneManager &&) = delete;
 
     Scene *getCurrentScene() const;
+    const std::vector<std::unique_ptr<Scene>> &getSceneStack() const { return m_sceneStack; } ///< @brief 获取场景栈 (从栈底到栈顶)
+    const Scene *getLoadingScene() const { return m_loadingScene.get(); }                     ///< @brief 获取正在后台准备的场景 (用于显示进度)，没有时为空
     engine::core::Context &getContext() const;
 
     void update(float deltaTime);
@@ -63,11 +80,14 @@ class SceneManager final {
     void onPopScene();
     void onPushScene(engine::utils::PushSceneEvent &event);
     void onReplaceScene(engine::utils::ReplaceSceneEvent &event);
+    void onPreloadScene(engine::utils::PreloadSceneEvent &event);
 
     void processPendingActions();
+    void processLoadingScene(); ///< @brief 后台准备完成时把场景压入或替换
     void pushScene(std::unique_ptr<Scene> &&scene);
     void popScene();
     void replaceScene(std::unique_ptr<Scene> &&scene);
+    void discardSnapshot(const Scene *scene); ///< @brief 丢弃场景的截图 (场景回到栈顶或被移除时调用)
 };
 
 } // namespace engine::scene
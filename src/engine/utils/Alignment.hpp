@@ -1,4 +1,5 @@
 #pragma once
+#include <glm/vec2.hpp>
 
 namespace engine::utils {
 
@@ -19,4 +20,26 @@ enum class Alignment {
     BOTTOM_RIGHT   // 右下角
 };
 
-} // namespace engine::utils
\ No newline at end of file
+/**
+ * @brief 计算按对齐方式放置时，左上角相对于参考点的偏移量
+ * @param alignment 对齐方式
+ * @param size 对象尺寸 (已包含缩放)
+ * @return 偏移量，NONE 时为 (0,0)
+ */
+inline glm::vec2 getAlignmentOffset(Alignment alignment, const glm::vec2 &size) {
+    switch (alignment) {
+    case Alignment::TOP_LEFT: return {0.0f, 0.0f};
+    case Alignment::TOP_CENTER: return {-size.x / 2.0f, 0.0f};
+    case Alignment::TOP_RIGHT: return {-size.x, 0.0f};
+    case Alignment::CENTER_LEFT: return {0.0f, -size.y / 2.0f};
+    case Alignment::CENTER: return {-size.x / 2.0f, -size.y / 2.0f};
+    case Alignment::CENTER_RIGHT: return {-size.x, -size.y / 2.0f};
+    case Alignment::BOTTOM_LEFT: return {0.0f, -size.y};
+    case Alignment::BOTTOM_CENTER: return {-size.x / 2.0f, -size.y};
+    case Alignment::BOTTOM_RIGHT: return {-size.x, -size.y};
+    case Alignment::NONE:
+    default: return {0.0f, 0.0f};
+    }
+}
+
+} // namespace engine::utils
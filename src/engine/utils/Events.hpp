@@ -16,5 +16,9 @@ struct PushSceneEvent {  // 压入场景事件
 struct ReplaceSceneEvent { // 替换场景事件
     std::unique_ptr<engine::scene::Scene> scene;
 };
+struct PreloadSceneEvent { // 后台准备场景事件 (准备完成后压入或替换)
+    std::unique_ptr<engine::scene::Scene> scene;
+    bool replace = false;
+};
 
 } // namespace engine::utils
\ No newline at end of file
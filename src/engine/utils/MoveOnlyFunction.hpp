@@ -0,0 +1,55 @@
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace engine::utils {
+
+template <typename Signature>
+class MoveOnlyFunction;
+
+/**
+ * @brief 只要求可移动的类型擦除可调用对象 (C++23 std::move_only_function 的最小替代)
+ *
+ * std::function 要求可拷贝，捕获了 unique_ptr 等只可移动参数的 lambda 无法放入；
+ * 这里用 unique_ptr 持有可调用对象，自身只可移动。空对象调用是未定义行为 (先用 operator bool 判断)。
+ */
+template <typename R, typename... Args>
+class MoveOnlyFunction<R(Args...)> final {
+  private:
+    /// @brief 类型擦除的调用接口
+    struct Callable {
+        virtual ~Callable() = default;
+        virtual R invoke(Args... args) = 0;
+    };
+    /// @brief 保存具体可调用对象
+    template <typename F>
+    struct Holder final : Callable {
+        F m_function;
+        explicit Holder(F &&function) : m_function(std::move(function)) {}
+        R invoke(Args... args) override { return std::invoke(m_function, std::forward<Args>(args)...); }
+    };
+
+    std::unique_ptr<Callable> m_callable; ///< @brief 持有的可调用对象，为空表示无目标
+
+  public:
+    MoveOnlyFunction() = default;
+    MoveOnlyFunction(std::nullptr_t) {}
+    template <typename F>
+        requires(!std::same_as<std::remove_cvref_t<F>, MoveOnlyFunction> && std::is_invocable_r_v<R, std::decay_t<F> &, Args...>)
+    MoveOnlyFunction(F &&function)
+        : m_callable(std::make_unique<Holder<std::decay_t<F>>>(std::decay_t<F>(std::forward<F>(function)))) {}
+
+    MoveOnlyFunction(MoveOnlyFunction &&) noexcept = default;
+    MoveOnlyFunction &operator=(MoveOnlyFunction &&) noexcept = default;
+    MoveOnlyFunction(const MoveOnlyFunction &) = delete;
+    MoveOnlyFunction &operator=(const MoveOnlyFunction &) = delete;
+
+    R operator()(Args... args) { return m_callable->invoke(std::forward<Args>(args)...); }
+    explicit operator bool() const { return m_callable != nullptr; }
+};
+
+} // namespace engine::utils
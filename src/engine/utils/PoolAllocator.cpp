@@ -0,0 +1,84 @@
+#include "PoolAllocator.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <new>
+
+namespace engine::utils {
+
+namespace {
+/// @brief 向上取整到 alignment 的倍数
+constexpr size_t alignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+} // namespace
+
+PoolAllocator::PoolAllocator(size_t objectSize)
+    : m_objectSize(objectSize), m_blockSize(HEADER_SIZE + alignUp(objectSize, HEADER_SIZE)) {}
+
+void *PoolAllocator::allocate() {
+    if (!m_freeList) {
+        addSlab();
+    }
+    FreeBlock *block = m_freeList;
+    m_freeList = block->next;
+    auto *header = reinterpret_cast<BlockHeader *>(block);
+    header->pool = this;
+    ++m_liveCount;
+    return reinterpret_cast<std::byte *>(header) + HEADER_SIZE;
+}
+
+bool PoolAllocator::release() {
+    if (m_liveCount > 0) {
+        spdlog::warn("POOLALLOCATOR::release::仍有 {} 个对象存活，暂不释放内存池", m_liveCount);
+        return false;
+    }
+    m_slabs.clear();
+    m_freeList = nullptr;
+    return true;
+}
+
+void *PoolAllocator::allocateUnpooled(size_t size) {
+    auto *header = static_cast<BlockHeader *>(::operator new(HEADER_SIZE + size));
+    header->pool = nullptr;
+    return reinterpret_cast<std::byte *>(header) + HEADER_SIZE;
+}
+
+void PoolAllocator::deallocate(void *object) {
+    if (!object) return;
+    auto *header = reinterpret_cast<BlockHeader *>(static_cast<std::byte *>(object) - HEADER_SIZE);
+    if (header->pool) {
+        header->pool->freeBlock(header);
+    } else {
+        ::operator delete(header);
+    }
+}
+
+void PoolAllocator::retire(std::unique_ptr<PoolAllocator> pool) {
+    if (!pool || pool->m_liveCount == 0) return; // unique_ptr 离开作用域时删除
+    spdlog::debug("POOLALLOCATOR::retire::所有者已销毁，但仍有 {} 个对象存活，内存池将在它们释放后删除", pool->m_liveCount);
+    pool->m_isRetired = true;
+    static_cast<void>(pool.release()); // 交给最后一个 freeBlock 删除
+}
+
+void PoolAllocator::addSlab() {
+    auto &slab = m_slabs.emplace_back(std::make_unique_for_overwrite<std::byte[]>(m_blockSize * BLOCKS_PER_SLAB));
+    // 倒序压入，使分配顺序与内存地址顺序一致
+    for (size_t i = BLOCKS_PER_SLAB; i-- > 0;) {
+        auto *block = reinterpret_cast<FreeBlock *>(slab.get() + i * m_blockSize);
+        block->next = m_freeList;
+        m_freeList = block;
+    }
+}
+
+void PoolAllocator::freeBlock(BlockHeader *block) {
+    auto *freeBlock = reinterpret_cast<FreeBlock *>(block);
+    freeBlock->next = m_freeList;
+    m_freeList = freeBlock;
+    --m_liveCount;
+    if (m_isRetired && m_liveCount == 0) {
+        delete this;
+    }
+}
+
+} // namespace engine::utils
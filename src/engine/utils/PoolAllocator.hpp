@@ -0,0 +1,81 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace engine::utils {
+
+/**
+ * @brief 定长内存池
+ *
+ * 按 slab (一次分配 BLOCKS_PER_SLAB 个块) 向系统申请内存，块用完后放回空闲链表复用，
+ * 因此稳定运行时分配/释放都不会调用 malloc/free，同类对象在内存中也是连续的。
+ *
+ * 每个块前面有一个块头记录所属的内存池，deallocate 是静态函数，只凭对象指针就能把块还给正确的池。
+ * 不来自内存池的对象 (allocateUnpooled) 块头为空，释放时交还给系统，
+ * 这样同一个类型可以混用两种来源，持有者统一用 delete / std::unique_ptr 释放即可。
+ *
+ * @note 非线程安全，同一个池只应在一个线程中分配和释放 (场景更新所在线程)
+ */
+class PoolAllocator final {
+  public:
+    static constexpr size_t HEADER_SIZE = alignof(std::max_align_t); ///< @brief 块头大小，同时保证对象的对齐
+    static constexpr size_t BLOCKS_PER_SLAB = 64;                      ///< @brief 每个 slab 的块数
+
+  private:
+    /// @brief 块头，位于对象之前
+    struct BlockHeader {
+        PoolAllocator *pool; ///< @brief 所属内存池，nullptr 表示直接来自系统
+    };
+    /// @brief 空闲块在原块头位置保存链表指针
+    struct FreeBlock {
+        FreeBlock *next;
+    };
+
+    size_t m_objectSize;                               ///< @brief 对象大小
+    size_t m_blockSize;                                ///< @brief 块大小 (块头 + 对象，按 HEADER_SIZE 对齐)
+    std::vector<std::unique_ptr<std::byte[]>> m_slabs; ///< @brief 已申请的 slab
+    FreeBlock *m_freeList = nullptr;                   ///< @brief 空闲块链表
+    size_t m_liveCount = 0;                            ///< @brief 已分配未释放的块数
+    bool m_isRetired = false;                          ///< @brief 所有者已销毁，最后一个块释放时自行删除
+
+  public:
+    /// @param objectSize 每个对象的大小 (字节)
+    explicit PoolAllocator(size_t objectSize);
+    ~PoolAllocator() = default;
+
+    PoolAllocator(const PoolAllocator &) = delete;
+    PoolAllocator &operator=(const PoolAllocator &) = delete;
+    PoolAllocator(PoolAllocator &&) = delete;
+    PoolAllocator &operator=(PoolAllocator &&) = delete;
+
+    /// @brief 分配一个块，返回对象地址 (未构造)
+    void *allocate();
+    /**
+     * @brief 没有存活对象时一次性释放所有 slab
+     * @return 是否已释放 (仍有存活对象时不释放)
+     */
+    bool release();
+
+    size_t getObjectSize() const { return m_objectSize; }                                      ///< @brief 获取对象大小
+    size_t getLiveCount() const { return m_liveCount; }                                        ///< @brief 获取存活对象数
+    size_t getCapacity() const { return m_slabs.size() * BLOCKS_PER_SLAB; }                    ///< @brief 获取当前容量 (块数)
+    size_t getReservedBytes() const { return m_slabs.size() * BLOCKS_PER_SLAB * m_blockSize; } ///< @brief 获取占用的内存
+
+    /// @brief 从系统分配一个带空块头的对象内存 (用于类的 operator new)
+    static void *allocateUnpooled(size_t size);
+    /// @brief 释放 allocate / allocateUnpooled 得到的对象内存 (用于类的 operator delete)
+    static void deallocate(void *object);
+    /**
+     * @brief 所有者销毁内存池
+     *
+     * 没有存活对象时立即删除；否则 (对象被转移给了其他所有者) 先保留，等最后一个对象释放时自行删除，避免悬空。
+     */
+    static void retire(std::unique_ptr<PoolAllocator> pool);
+
+  private:
+    void addSlab();                     ///< @brief 申请一个新的 slab 并把其中的块加入空闲链表
+    void freeBlock(BlockHeader *block); ///< @brief 把块放回空闲链表
+};
+
+} // namespace engine::utils
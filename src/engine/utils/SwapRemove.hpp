@@ -0,0 +1,25 @@
+#pragma once
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace engine::utils {
+
+/**
+ * @brief O(1) 移除无序列表中的元素：与末尾元素交换后弹出
+ *
+ * 元素记录了自己在列表中的位置时，被换过来的末尾元素需要更新位置，由 onMoved 完成。
+ * @param list 无序列表
+ * @param pos 要移除的元素位置 (必须有效)
+ * @param onMoved 以 (被换到 pos 的元素, pos) 调用；移除的正是末尾元素时不调用
+ */
+template <typename T, typename OnMoved>
+void swapRemove(std::vector<T> &list, size_t pos, OnMoved &&onMoved) {
+    if (pos + 1 != list.size()) {
+        list[pos] = std::move(list.back());
+        onMoved(list[pos], pos);
+    }
+    list.pop_back();
+}
+
+} // namespace engine::utils
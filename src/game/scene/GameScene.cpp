@@ -1,6 +1,9 @@
 #include "GameScene.hpp"
 #include "../../engine/core/Context.hpp"
+#include "../../engine/ecs/EntityFactory.hpp"
+#include "../../engine/ecs/PrototypeCache.hpp"
 #include "../../engine/input/InputManager.hpp"
+#include "../../engine/render/Camera.hpp"
 #include "../../engine/utils/Events.hpp"
 
 #include <entt/core/hashed_string.hpp>
@@ -8,9 +11,14 @@
 #include <entt/signal/sigh.hpp>
 #include <spdlog/spdlog.h>
 
+#include <array>
+#include <string_view>
+
 namespace game::scene {
 GameScene::GameScene(engine::core::Context &context)
     : engine::scene::Scene("GameScene", context) {
+    setParallelUpdate(true); // 动画、生命值等计时器组件并行更新
+    setFreezeWhenCovered(true); // 被压入的场景覆盖时不再实时渲染，只绘制截图
 }
 
 GameScene::~GameScene() {
@@ -27,6 +35,7 @@ void GameScene::init() {
     inputManager.onAction(entt::hashed_string{"mouse_right"}).connect<&GameScene::onPop>(this); // mouse right
     inputManager.onAction(entt::hashed_string{"pause"}).connect<&GameScene::onQuit>(this);      // p
 
+    spawnUnits();
     Scene::init();
 }
 
@@ -40,6 +49,29 @@ void GameScene::clean() {
     Scene::clean();
 }
 
+void GameScene::spawnUnits() {
+    // 单位数量多、组件固定，作为 ECS 实体生成：动画与生命值由 ecs 系统批量更新，精灵由 ecs::renderSprites 录制
+    constexpr std::array<std::string_view, 4> PLAYER_KEYS = {"warrior", "archer", "lancer", "witch"};
+    constexpr std::array<std::string_view, 4> ENEMY_KEYS = {"slime", "wolf", "goblin", "dark_witch"};
+    const auto &prototypeCache = m_context.getPrototypeCache();
+    auto factory = createEntityFactory();
+    glm::vec2 viewportSize = m_context.getCamera().getViewportSize();
+    auto spawnRow = [&](std::string_view category, const auto &keys, float y) {
+        for (size_t i = 0; i < keys.size(); ++i) {
+            const auto *prototype = prototypeCache.get(category, keys[i]);
+            if (!prototype) {
+                spdlog::warn("GameScene::spawnUnits::找不到原型 {}/{}", category, keys[i]);
+                continue;
+            }
+            float x = viewportSize.x * static_cast<float>(i + 1) / static_cast<float>(keys.size() + 1);
+            factory.spawn(*prototype, {x, y});
+        }
+    };
+    spawnRow("enemy", ENEMY_KEYS, viewportSize.y * 0.4f);
+    spawnRow("player", PLAYER_KEYS, viewportSize.y * 0.7f);
+    spdlog::info("GameScene::spawnUnits::生成了 {} 个单位实体", getEntityCount());
+}
+
 bool GameScene::onReplace() {
     spdlog::info("GameScene::onReplace() {}", sceneNum);
     requestReplaceScene(std::make_unique<game::scene::GameScene>(m_context));
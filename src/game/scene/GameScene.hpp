@@ -12,6 +12,7 @@ class GameScene final : public engine::scene::Scene {
 
   private:
     int sceneNum{0};
+    void spawnUnits(); ///< @brief 按原型把玩家与敌人单位生成为 ECS 实体
     bool onReplace();
     bool onPush();
     bool onPop();
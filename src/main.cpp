@@ -1,5 +1,6 @@
 #include "engine/core/Context.hpp"
 #include "engine/core/Game.hpp"
+#include "engine/ecs/PrototypeCache.hpp"
 #include "engine/scene/SceneManager.hpp"
 #include "engine/utils/Events.hpp"
 #include "game/scene/GameScene.hpp"
@@ -8,16 +9,43 @@
 #include <entt/signal/dispatcher.hpp>
 #include <spdlog/spdlog.h>
 
+#include <cstdlib>
+#include <string_view>
+
 void setupInitialScene(engine::core::Context &context) {
+    // 启动时把实体数据编译为原型，之后生成实体不再解析 JSON
+    auto &prototypeCache = context.getPrototypeCache();
+    // 逐个加载，某个文件失败时其余类别仍然可用
+    bool isLoaded = prototypeCache.loadFile("enemy", "assets/data/enemy_data.json");
+    isLoaded &= prototypeCache.loadFile("player", "assets/data/player_data.json");
+    isLoaded &= prototypeCache.loadFile("projectile", "assets/data/projectile_data.json");
+    isLoaded &= prototypeCache.loadFile("effect", "assets/data/effect_data.json");
+    if (!isLoaded) {
+        spdlog::warn("MAIN::setupInitialScene::部分实体数据加载失败");
+    }
+
     // GameApp在调用run方法之前，先创建并设置初始场景
     auto titleScene = std::make_unique<game::scene::GameScene>(context);
     context.getDispatcher().trigger<engine::utils::PushSceneEvent>(engine::utils::PushSceneEvent{std::move(titleScene)});
 }
 
-int main() {
+int main(int argc, char *argv[]) {
     spdlog::set_level(spdlog::level::trace);
 
+    // 命令行参数: --headless 以无头模式运行, --frames N 运行 N 帧后退出
+    bool headless = false;
+    int maxFrames = 0;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--headless") {
+            headless = true;
+        } else if (arg == "--frames" && i + 1 < argc) {
+            maxFrames = std::atoi(argv[++i]);
+        }
+    }
+
     engine::core::Game app;
+    app.setHeadless(headless, maxFrames);
     app.registerSceneSetup(setupInitialScene);
     app.run();
     return 0;
@@ -0,0 +1,20 @@
+#pragma once
+#include <cstdio>
+
+/**
+ * @brief 单元测试用的极简检查宏
+ *
+ * 失败时打印位置与表达式并计数，不中断后续检查；与 assert 不同，Release 构建下同样生效。
+ * 测试的 main 以 TEST_RESULT() 返回，失败数非 0 时 ctest 判定失败。
+ */
+inline int g_checkFailures = 0;
+
+#define CHECK(expr)                                                                   \
+    do {                                                                              \
+        if (!(expr)) {                                                                \
+            std::fprintf(stderr, "%s:%d: CHECK(%s) 失败\n", __FILE__, __LINE__, #expr); \
+            ++g_checkFailures;                                                        \
+        }                                                                             \
+    } while (false)
+
+#define TEST_RESULT() (g_checkFailures == 0 ? 0 : 1)
@@ -0,0 +1,69 @@
+#include "../src/engine/object/HandleTable.hpp"
+#include "Check.hpp"
+
+#include <cstdint>
+#include <vector>
+
+using engine::object::HandleTable;
+using engine::object::ObjectHandle;
+
+namespace {
+
+struct TestSlot {
+    int value = 0;
+    std::uint32_t generation = 1;
+};
+
+/// @brief 释放后旧句柄失效，复用槽位时代数加一
+void testGeneration() {
+    HandleTable<TestSlot> table;
+    CHECK(!table.isValid(ObjectHandle{}));
+    CHECK(table.get(ObjectHandle{}) == nullptr);
+
+    auto a = table.acquire();
+    auto b = table.acquire();
+    CHECK(a.index == 0 && b.index == 1);
+    CHECK(a.generation == 1 && b.generation == 1);
+    CHECK(!a.isNull());
+    table.get(a)->value = 10;
+    table.get(b)->value = 20;
+
+    CHECK(table.release(a));
+    CHECK(!table.isValid(a));
+    CHECK(table.get(a) == nullptr);
+    CHECK(!table.release(a)); // 重复释放被拒绝
+    CHECK(table.get(b) != nullptr && table.get(b)->value == 20);
+
+    auto c = table.acquire(); // 复用槽位 0
+    CHECK(c.index == a.index);
+    CHECK(c.generation == a.generation + 1);
+    CHECK(table.get(c) != nullptr && table.get(c)->value == 0); // 槽位已重置
+    CHECK(table.get(a) == nullptr);                             // 旧句柄仍然失效
+    CHECK(table.size() == 2);
+
+    // 代数不同或越界的句柄都无法匹配
+    CHECK(!table.isValid({b.index, b.generation + 1}));
+    CHECK(!table.isValid({5, 1}));
+}
+
+/// @brief 反复分配释放同一个槽位，每个旧句柄都只匹配自己那一代
+void testGenerationChurn() {
+    HandleTable<TestSlot> table;
+    std::vector<ObjectHandle> history;
+    for (int i = 0; i < 100; ++i) {
+        auto handle = table.acquire();
+        history.push_back(handle);
+        CHECK(table.release(handle));
+    }
+    CHECK(table.size() == 1);
+    for (size_t i = 0; i + 1 < history.size(); ++i) CHECK(history[i].generation + 1 == history[i + 1].generation);
+    for (auto handle : history) CHECK(!table.isValid(handle));
+}
+
+} // namespace
+
+int main() {
+    testGeneration();
+    testGenerationChurn();
+    return TEST_RESULT();
+}
@@ -0,0 +1,97 @@
+#include "../src/engine/debug/Histogram.hpp"
+#include "Check.hpp"
+
+#include <cmath>
+#include <random>
+
+using engine::debug::Histogram;
+
+namespace {
+
+/// @brief 相对误差不超过 1 / 64
+bool isClose(double value, double expected) {
+    return std::abs(value - expected) <= expected / 64.0;
+}
+
+void testEmpty() {
+    Histogram histogram;
+    CHECK(histogram.getCount() == 0);
+    CHECK(histogram.getValueAtPercentile(50.0) == 0.0);
+    CHECK(histogram.getMean() == 0.0);
+    CHECK(histogram.getMax() == 0);
+}
+
+/// @brief 线性区间内每个整数一个桶，百分位取桶中点且不超过最大值
+void testLinearRange() {
+    Histogram histogram;
+    for (Uint64 value = 1; value <= 100; ++value) histogram.record(value);
+    CHECK(histogram.getCount() == 100);
+    CHECK(histogram.getMax() == 100);
+    CHECK(histogram.getMean() == 50.5);
+    CHECK(histogram.getValueAtPercentile(0.0) == 1.5); // 至少取第一个样本
+    CHECK(histogram.getValueAtPercentile(50.0) == 50.5);
+    CHECK(histogram.getValueAtPercentile(99.0) == 99.5);
+    CHECK(histogram.getValueAtPercentile(100.0) == 100.0);
+    CHECK(histogram.getValueAtPercentile(250.0) == 100.0); // 超出范围的百分位按 100 计
+}
+
+/// @brief 任意量级的单个样本，结果都在 1 / 64 的相对误差内
+void testRelativeError() {
+    for (Uint64 value : {Uint64{127}, Uint64{128}, Uint64{1000}, Uint64{16667}, Uint64{33333}, Uint64{999999}, Uint64{59000000}}) {
+        Histogram histogram;
+        histogram.record(value);
+        histogram.record(Histogram::MAX_VALUE); // 避免结果被最大值截断
+        CHECK(isClose(histogram.getValueAtPercentile(50.0), static_cast<double>(value)));
+    }
+}
+
+/// @brief 长尾分布: 少量尖峰只出现在高百分位
+void testTail() {
+    Histogram histogram;
+    for (int i = 0; i < 1000; ++i) histogram.record(1000);
+    for (int i = 0; i < 10; ++i) histogram.record(50000);
+    CHECK(isClose(histogram.getValueAtPercentile(50.0), 1000.0));
+    CHECK(isClose(histogram.getValueAtPercentile(99.0), 1000.0));
+    CHECK(isClose(histogram.getValueAtPercentile(99.9), 50000.0));
+    CHECK(histogram.getMax() == 50000);
+}
+
+/// @brief 百分位随百分比单调不减
+void testMonotonic() {
+    Histogram histogram;
+    std::mt19937 rng(42);
+    std::lognormal_distribution<double> distribution(9.0, 1.0);
+    for (int i = 0; i < 10000; ++i) histogram.record(static_cast<Uint64>(distribution(rng)));
+    double previous = 0.0;
+    for (double percentile = 0.0; percentile <= 100.0; percentile += 0.5) {
+        double value = histogram.getValueAtPercentile(percentile);
+        CHECK(value >= previous);
+        previous = value;
+    }
+    CHECK(isClose(previous, static_cast<double>(histogram.getMax()))); // 最大样本所在桶的中点，不超过最大值
+    CHECK(previous <= static_cast<double>(histogram.getMax()));
+}
+
+/// @brief 超过上限的样本按上限记录；reset 清空所有样本
+void testClampAndReset() {
+    Histogram histogram;
+    histogram.record(Histogram::MAX_VALUE * 2);
+    CHECK(histogram.getMax() == Histogram::MAX_VALUE);
+    CHECK(histogram.getValueAtPercentile(100.0) == static_cast<double>(Histogram::MAX_VALUE));
+    histogram.reset();
+    CHECK(histogram.getCount() == 0);
+    CHECK(histogram.getMax() == 0);
+    CHECK(histogram.getValueAtPercentile(100.0) == 0.0);
+}
+
+} // namespace
+
+int main() {
+    testEmpty();
+    testLinearRange();
+    testRelativeError();
+    testTail();
+    testMonotonic();
+    testClampAndReset();
+    return TEST_RESULT();
+}
@@ -0,0 +1,109 @@
+#include "../src/engine/utils/PoolAllocator.hpp"
+#include "Check.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <vector>
+
+using engine::utils::PoolAllocator;
+
+namespace {
+
+/// @brief 分配的块互不重叠、满足对齐，超出一个 slab 时才申请新的 slab
+void testAllocate() {
+    PoolAllocator pool(24);
+    std::vector<void *> objects;
+    for (size_t i = 0; i < PoolAllocator::BLOCKS_PER_SLAB; ++i) objects.push_back(pool.allocate());
+    CHECK(pool.getCapacity() == PoolAllocator::BLOCKS_PER_SLAB);
+    CHECK(pool.getLiveCount() == PoolAllocator::BLOCKS_PER_SLAB);
+    objects.push_back(pool.allocate());
+    CHECK(pool.getCapacity() == 2 * PoolAllocator::BLOCKS_PER_SLAB);
+
+    std::set<void *> unique(objects.begin(), objects.end());
+    CHECK(unique.size() == objects.size());
+    for (auto *object : objects) {
+        CHECK(reinterpret_cast<std::uintptr_t>(object) % alignof(std::max_align_t) == 0);
+    }
+    // 同一 slab 内按地址顺序分配，相邻块不重叠
+    auto first = reinterpret_cast<std::uintptr_t>(objects[0]);
+    auto second = reinterpret_cast<std::uintptr_t>(objects[1]);
+    CHECK(second > first && second - first >= 24 + PoolAllocator::HEADER_SIZE);
+
+    for (auto *object : objects) PoolAllocator::deallocate(object);
+    CHECK(pool.getLiveCount() == 0);
+}
+
+/// @brief 释放的块放回空闲链表，下一次分配直接复用，不增加容量
+void testReuse() {
+    PoolAllocator pool(16);
+    void *a = pool.allocate();
+    void *b = pool.allocate();
+    PoolAllocator::deallocate(a);
+    CHECK(pool.getLiveCount() == 1);
+    CHECK(pool.allocate() == a);
+    CHECK(pool.getCapacity() == PoolAllocator::BLOCKS_PER_SLAB);
+    PoolAllocator::deallocate(a);
+    PoolAllocator::deallocate(b);
+    PoolAllocator::deallocate(nullptr); // 空指针忽略
+    CHECK(pool.getLiveCount() == 0);
+}
+
+/// @brief 不来自内存池的对象交还给系统，不影响任何池的计数
+void testUnpooled() {
+    PoolAllocator pool(8);
+    void *pooled = pool.allocate();
+    void *unpooled = PoolAllocator::allocateUnpooled(8);
+    CHECK(unpooled != nullptr);
+    CHECK(reinterpret_cast<std::uintptr_t>(unpooled) % alignof(std::max_align_t) == 0);
+    PoolAllocator::deallocate(unpooled);
+    CHECK(pool.getLiveCount() == 1);
+    PoolAllocator::deallocate(pooled);
+}
+
+/// @brief 仍有存活对象时 release 拒绝释放
+void testRelease() {
+    PoolAllocator pool(32);
+    void *object = pool.allocate();
+    CHECK(!pool.release());
+    CHECK(pool.getCapacity() == PoolAllocator::BLOCKS_PER_SLAB);
+    PoolAllocator::deallocate(object);
+    CHECK(pool.release());
+    CHECK(pool.getCapacity() == 0);
+    CHECK(pool.getReservedBytes() == 0);
+    // 释放后仍可继续分配
+    object = pool.allocate();
+    CHECK(pool.getCapacity() == PoolAllocator::BLOCKS_PER_SLAB);
+    PoolAllocator::deallocate(object);
+}
+
+/// @brief 所有者销毁后，存活对象仍可使用并正常释放 (最后一个释放时池自行删除)
+void testRetire() {
+    PoolAllocator::retire(std::make_unique<PoolAllocator>(16)); // 没有存活对象，立即删除
+    PoolAllocator::retire(nullptr);
+
+    auto pool = std::make_unique<PoolAllocator>(sizeof(int));
+    auto *a = static_cast<int *>(pool->allocate());
+    auto *b = static_cast<int *>(pool->allocate());
+    *a = 1;
+    *b = 2;
+    PoolAllocator::retire(std::move(pool));
+    CHECK(*a == 1 && *b == 2);
+    PoolAllocator::deallocate(a);
+    CHECK(*b == 2);
+    PoolAllocator::deallocate(b); // 池在这里删除 (由 AddressSanitizer / Valgrind 检查泄漏与悬空访问)
+}
+
+} // namespace
+
+int main() {
+    spdlog::set_level(spdlog::level::off);
+    testAllocate();
+    testReuse();
+    testUnpooled();
+    testRelease();
+    testRetire();
+    return TEST_RESULT();
+}
@@ -0,0 +1,89 @@
+#include "../src/engine/render/RenderCommand.hpp"
+#include "Check.hpp"
+
+#include <random>
+#include <vector>
+
+using engine::render::RenderCommandList;
+using engine::render::RenderCommandType;
+using engine::render::RenderLayer;
+
+namespace {
+
+/// @brief 排序后命令下标的提交顺序
+std::vector<Uint32> sortedOrder(RenderCommandList &list) {
+    list.sort();
+    return list.getOrder();
+}
+
+/// @brief 排序键相同的命令保持录制顺序 (基数排序必须稳定)
+void testStability() {
+    RenderCommandList list;
+    std::mt19937 rng(7);
+    for (int i = 0; i < 5000; ++i) {
+        auto layer = (rng() % 2) ? RenderLayer::Units : RenderLayer::Ground;
+        auto &command = list.push(RenderCommandType::Sprite, layer);
+        list.setDepth(command, static_cast<float>(rng() % 50) - 25.0f, (rng() % 3) ? "a" : "b");
+    }
+    auto order = sortedOrder(list);
+    const auto &commands = list.getCommands();
+    CHECK(order.size() == commands.size());
+    for (size_t i = 1; i < order.size(); ++i) {
+        const auto &previous = commands[order[i - 1]];
+        const auto &current = commands[order[i]];
+        CHECK(previous.sortKey <= current.sortKey);
+        if (previous.sortKey == current.sortKey) CHECK(order[i - 1] < order[i]);
+    }
+}
+
+/// @brief 所有键相同时 (基数排序跳过全部字节) 顺序不变
+void testIdenticalKeys() {
+    RenderCommandList list;
+    for (int i = 0; i < 100; ++i) list.push(RenderCommandType::UISprite);
+    auto order = sortedOrder(list);
+    for (Uint32 i = 0; i < order.size(); ++i) CHECK(order[i] == i);
+}
+
+/// @brief 批次优先于图层，图层优先于深度；负深度排在正深度之前；不按深度排序的图层忽略 setDepth
+void testKeyPriority() {
+    RenderCommandList list;
+    list.beginPass();
+    list.setDepth(list.push(RenderCommandType::Sprite, RenderLayer::Units), 3.0f, "a");  // 0
+    list.setDepth(list.push(RenderCommandType::Sprite, RenderLayer::Units), -5.0f, "a"); // 1
+    list.setDepth(list.push(RenderCommandType::Sprite, RenderLayer::Units), 0.0f, "a");  // 2
+    list.setDepth(list.push(RenderCommandType::Sprite, RenderLayer::Ground), 9.0f, "a"); // 3 (地面不按深度排序)
+    list.push(RenderCommandType::Sprite, RenderLayer::Ground);                           // 4
+    list.push(RenderCommandType::UIText);                                                // 5
+    list.beginPass();
+    list.push(RenderCommandType::Sprite, RenderLayer::Background); // 6 (后一个批次，整体在上)
+    auto order = sortedOrder(list);
+    CHECK((order == std::vector<Uint32>{3, 4, 1, 2, 0, 5, 6}));
+}
+
+/// @brief 截图段提前执行，嵌套段排在外层段之前且不拆分外层段的排序
+void testCaptureSegments() {
+    RenderCommandList list;
+    list.push(RenderCommandType::Sprite, RenderLayer::Units);  // 0 屏幕
+    list.push(RenderCommandType::BeginCapture);                // 1 外层截图 (冻结场景)
+    list.push(RenderCommandType::Sprite, RenderLayer::Units);  // 2
+    list.push(RenderCommandType::BeginCapture);                // 3 嵌套截图 (烘焙区块)
+    list.push(RenderCommandType::UISprite);                    // 4
+    list.push(RenderCommandType::EndCapture);                  // 5
+    list.push(RenderCommandType::Sprite, RenderLayer::Ground); // 6 区块精灵
+    list.push(RenderCommandType::EndCapture);                  // 7
+    list.push(RenderCommandType::DrawCapture);                 // 8
+    list.push(RenderCommandType::FreeCapture);                 // 9
+    list.push(RenderCommandType::EndCapture);                  // 10 未配对，忽略
+    auto order = sortedOrder(list);
+    CHECK((order == std::vector<Uint32>{3, 4, 5, 1, 6, 2, 7, 0, 8, 9}));
+}
+
+} // namespace
+
+int main() {
+    testStability();
+    testIdenticalKeys();
+    testKeyPriority();
+    testCaptureSegments();
+    return TEST_RESULT();
+}
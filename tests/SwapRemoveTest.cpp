@@ -0,0 +1,48 @@
+#include "../src/engine/utils/SwapRemove.hpp"
+#include "Check.hpp"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+/// @brief 交换移除后，被换过来的元素记录的位置随之更新
+void testPositionsFollowSwaps() {
+    std::vector<std::string> list = {"a", "b", "c", "d"};
+    std::unordered_map<std::string, size_t> positions = {{"a", 0}, {"b", 1}, {"c", 2}, {"d", 3}};
+    auto onMoved = [&](const std::string &moved, size_t pos) { positions[moved] = pos; };
+    auto remove = [&](const std::string &key) {
+        engine::utils::swapRemove(list, positions[key], onMoved);
+        positions.erase(key);
+    };
+
+    remove("b"); // 末尾的 d 换到位置 1
+    CHECK((list == std::vector<std::string>{"a", "d", "c"}));
+    remove("c"); // 移除的就是末尾元素，不调用 onMoved
+    CHECK((list == std::vector<std::string>{"a", "d"}));
+    remove("a");
+    CHECK((list == std::vector<std::string>{"d"}));
+    for (const auto &[key, pos] : positions) CHECK(list[pos] == key);
+    remove("d");
+    CHECK(list.empty());
+}
+
+/// @brief 移除末尾元素时不调用 onMoved
+void testRemoveLast() {
+    int movedCalls = 0;
+    std::vector<int> list = {1, 2, 3};
+    engine::utils::swapRemove(list, 2, [&](int, size_t) { ++movedCalls; });
+    CHECK((list == std::vector<int>{1, 2}));
+    engine::utils::swapRemove(list, 1, [&](int, size_t) { ++movedCalls; });
+    engine::utils::swapRemove(list, 0, [&](int, size_t) { ++movedCalls; });
+    CHECK(list.empty() && movedCalls == 0);
+}
+
+} // namespace
+
+int main() {
+    testPositionsFollowSwaps();
+    testRemoveLast();
+    return TEST_RESULT();
+}